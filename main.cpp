@@ -2,6 +2,10 @@
 #include <iostream>
 #include <array>
 #include <vector>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <filesystem>
 
 namespace {
 
@@ -86,6 +90,51 @@ void element_2d_integrate_test(const metamath::finite_element::element_2d_integr
               << "sum_deta = " << sum_deta << std::endl; // Сумма всех производных во всех квадратурных узлах равна 0
 }
 
+// Тест для вычислений в смешанной точности.
+// Сравниваются таблицы элемента, построенные в исходной точности, и таблицы, функции формы которых вычислялись в меньшей точности.
+template<class T>
+void mixed_precision_1d_test(const metamath::finite_element::element_1d_integrate_base<T>& element,
+                             const metamath::finite_element::element_1d_integrate_base<T>& mixed) {
+    T N_error = 0, Nxi_error = 0;
+    for(size_t i = 0; i < element.nodes_count(); ++i)
+        for(size_t q = 0; q < element.qnodes_count(); ++q) {
+            N_error   = std::max(N_error,   std::abs(element.qN  (i, q) - mixed.qN  (i, q)));
+            Nxi_error = std::max(Nxi_error, std::abs(element.qNxi(i, q) - mixed.qNxi(i, q)));
+        }
+    std::cout << "max |N   - N_mixed  | = " << N_error   << std::endl
+              << "max |Nxi - Nxi_mixed| = " << Nxi_error << std::endl;
+}
+
+template<class T>
+void mixed_precision_2d_test(const metamath::finite_element::element_2d_integrate_base<T>& element,
+                             const metamath::finite_element::element_2d_integrate_base<T>& mixed) {
+    T N_error = 0, Nxi_error = 0, Neta_error = 0;
+    for(size_t i = 0; i < element.nodes_count(); ++i)
+        for(size_t q = 0; q < element.qnodes_count(); ++q) {
+            N_error    = std::max(N_error,    std::abs(element.qN   (i, q) - mixed.qN   (i, q)));
+            Nxi_error  = std::max(Nxi_error,  std::abs(element.qNxi (i, q) - mixed.qNxi (i, q)));
+            Neta_error = std::max(Neta_error, std::abs(element.qNeta(i, q) - mixed.qNeta(i, q)));
+        }
+    std::cout << "max |N    - N_mixed   | = " << N_error    << std::endl
+              << "max |Nxi  - Nxi_mixed | = " << Nxi_error  << std::endl
+              << "max |Neta - Neta_mixed| = " << Neta_error << std::endl;
+}
+
+// Тест пакетного вычисления функций формы.
+// Сравниваются переопределённый метод tabulate и реализация базового класса, вычисляющая функции формы по одной.
+template<class T>
+void tabulate_2d_test(const metamath::finite_element::element_2d_base<T>& element, const std::vector<std::array<T, 2>>& points) {
+    using metamath::finite_element::derivative_2d;
+    static constexpr derivative_2d mask = derivative_2d::N | derivative_2d::XI | derivative_2d::ETA;
+    std::vector<T> bulk(3 * element.nodes_count() * points.size()), single(bulk.size());
+    element.tabulate(points, mask, bulk.data());
+    element.metamath::finite_element::element_2d_base<T>::tabulate(points, mask, single.data());
+    T error = 0;
+    for(size_t i = 0; i < bulk.size(); ++i)
+        error = std::max(error, std::abs(bulk[i] - single[i]));
+    std::cout << "max |tabulate - N| = " << error << std::endl;
+}
+
 }
 
 int main() {
@@ -96,6 +145,116 @@ int main() {
 
     std::cout << std::endl << std::endl;
 
+    std::cout << "SUBSTITUTE_TEST: " << std::endl;
+    {
+        // Подстановка x^2 + y вместо x в f(x) = x exp(x): производная g(x, y) = f(x^2 + y) вычисляется по правилу дифференцирования сложной функции
+        using namespace metamath::symdiff;
+        static constexpr variable<0> x{};
+        static constexpr variable<1> y{};
+        static constexpr auto g = substitute<0>(x * exp(x), x * x + y);
+        static constexpr auto dg = derivative<x>(g);
+        double error = 0;
+        for(const std::array<double, 2>& point : {std::array{0.5, 0.25}, std::array{-1.0, 0.5}, std::array{0.3, -0.7}}) {
+            const double value = point[0] * point[0] + point[1];
+            error = std::max(error, std::abs(dg(point) - 2 * point[0] * (1 + value) * std::exp(value))); // Аналитическая производная 2 x (1 + u) exp(u), u = x^2 + y
+        }
+        std::cout << "max |dg/dx - 2x (1 + u) exp(u)| = " << error << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "EVALUATE_PARALLEL_TEST: " << std::endl;
+    {
+        // Параллельное вычисление должно совпадать с последовательным, в том числе когда число точек не кратно размеру порции
+        using namespace metamath::symdiff;
+        static constexpr variable<0> x{};
+        static constexpr variable<1> y{};
+        static constexpr auto expressions = std::make_tuple(sin(x) * exp(y), x * x + y, log(1 + x * x));
+        double error = 0;
+        for(const size_t count : {size_t{1}, size_t{1000}, size_t{100003}}) {
+            std::vector<std::array<double, 2>> points(count);
+            for(size_t k = 0; k < count; ++k)
+                points[k] = {double(k) / count, 1 - double(k) / count};
+            std::vector<double> serial(3 * count), parallel(3 * count);
+            evaluate(expressions, points, serial.data());
+            evaluate_parallel(expressions, points, parallel.data(), 4);
+            for(size_t k = 0; k < serial.size(); ++k)
+                error = std::max(error, std::abs(serial[k] - parallel[k]));
+        }
+        std::cout << "max |evaluate_parallel - evaluate| = " << error << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "TAYLOR_TEST: " << std::endl;
+    {
+        // Производные до порядка K за один проход: (exp(2x))^(k) = 2^k exp(2x), sin^(k)(x) = sin(x + k pi / 2)
+        using namespace metamath::symdiff;
+        static constexpr variable<0> x{};
+        static constexpr size_t K = 8;
+        const std::array<double, 1> point = {0.7};
+        const std::array<double, K + 1> exp_derivatives = taylor_derivatives<0, K>(exp(2 * x), point),
+                                        sin_derivatives = taylor_derivatives<0, K>(sin(x), point);
+        double exp_error = 0, sin_error = 0;
+        for(size_t k = 0; k <= K; ++k) {
+            const double exact = std::pow(2.0, double(k)) * std::exp(2 * point[0]);
+            exp_error = std::max(exp_error, std::abs(exp_derivatives[k] - exact) / exact);
+            sin_error = std::max(sin_error, std::abs(sin_derivatives[k] - std::sin(point[0] + k * std::acos(-1.0) / 2)));
+        }
+        std::cout << "K = " << K << std::endl
+                  << "max relative error exp(2x) = " << exp_error << std::endl
+                  << "max error sin(x) = " << sin_error << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "CHEBYSHEV_APPROXIMATION_TEST: " << std::endl;
+    {
+        // Погрешность приближения на мелкой сетке не должна превышать заданную, производная приближения сравнивается с точной.
+        // По неравенству Маркова погрешность производной полинома степени n может быть в 2 n^2 / (b - a) раз больше погрешности самого приближения
+        using namespace metamath::symdiff;
+        static constexpr variable<0> x{};
+        static constexpr variable<1> y{};
+        static constexpr auto f = exp(x) * sin(3 * x);
+        static constexpr auto g = exp(-x * y) * cos(x + y);
+        static constexpr double tolerance = 1e-10;
+        const auto f_proxy = approximate<0>(f, std::array{-1.0, 2.0}, tolerance);
+        const auto g_proxy = approximate<0, 1>(g, std::array{0.0, 1.0}, std::array{-1.0, 1.0}, tolerance);
+        const auto df = derivative<x>(f);
+        const auto df_proxy = derivative<x>(f_proxy);
+        const auto dg = derivative<y>(g);
+        const auto dg_proxy = derivative<y>(g_proxy);
+        // Приближение с переставленными переменными: первой идёт y, поэтому пакетное вычисление должно брать координаты по номерам переменных
+        const auto g_swapped = approximate<1, 0>(g, std::array{-1.0, 1.0}, std::array{0.0, 1.0}, tolerance);
+        std::vector<std::array<double, 2>> points;
+        double f_error = 0, df_error = 0, g_error = 0, dg_error = 0;
+        for(size_t i = 0; i <= 200; ++i) {
+            const std::array<double, 1> point = {-1 + 3 * double(i) / 200};
+            f_error  = std::max(f_error,  std::abs(f_proxy(point) - f(point)));
+            df_error = std::max(df_error, std::abs(df_proxy(point) - df(point)));
+            for(size_t j = 0; j <= 200; ++j) {
+                const std::array<double, 2> point_2d = {double(i) / 200, -1 + 2 * double(j) / 200};
+                g_error  = std::max(g_error,  std::abs(g_proxy(point_2d) - g(point_2d)));
+                dg_error = std::max(dg_error, std::abs(dg_proxy(point_2d) - dg(point_2d)));
+                points.push_back(point_2d);
+            }
+        }
+        std::vector<double> batched(points.size());
+        g_swapped(points, batched.data());
+        double batched_error = 0, swapped_error = 0;
+        for(size_t k = 0; k < points.size(); ++k) {
+            batched_error = std::max(batched_error, std::abs(batched[k] - g_swapped(points[k])));
+            swapped_error = std::max(swapped_error, std::abs(g_swapped(points[k]) - g(points[k])));
+        }
+        std::cout << "tolerance = " << tolerance << std::endl
+                  << "degree = " << f_proxy.coefficients().size() - 1 << ", max |f - f_proxy| = " << f_error
+                  << ", max |df/dx - df_proxy/dx| = " << df_error << std::endl
+                  << "max |g - g_proxy| = " << g_error << ", max |dg/dy - dg_proxy/dy| = " << dg_error << std::endl
+                  << "swapped variables: max |g - g_proxy| = " << swapped_error << ", max |batched - scalar| = " << batched_error << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
     using namespace metamath::finite_element;
 
     // quadrature_1d_base<T> --- абстрактный класс
@@ -133,6 +292,10 @@ int main() {
     std::cout << std::endl;
     std::cout << "Qubic: " << std::endl;
     element_1d_integrate_test(element_1d_integrate<double, qubic>{quadrature_1d<double, gauss2>{}});
+    std::cout << std::endl;
+    // Порядок элемента lagrange задаётся во время выполнения программы, узлы --- равномерные или Гаусса-Лобатто
+    std::cout << "Lagrange (order 8, Gauss-Lobatto nodes): " << std::endl;
+    element_1d_integrate_test(element_1d_integrate<double, lagrange>{quadrature_1d<double, gauss5>{}, size_t{8}, lagrange_nodes::GAUSS_LOBATTO});
 
 
     std::cout << std::endl << std::endl;
@@ -172,5 +335,431 @@ int main() {
 //    std::cout << "quintic_serendipity:" <<std::endl;
 //    element_2d_integrate_test(element_2d_integrate<double,   quintic_serendipity>{quadrature_1d<double, gauss4>{}});
 
+    // Элементы высоких порядков, базис которых строится во время выполнения программы обращением матрицы Вандермонда
+    std::cout << std::endl;
+    std::cout << "nodal_qubic_triangle:" << std::endl;
+    element_2d_integrate_test(element_2d_integrate<double, nodal_qubic_triangle>{quadrature_1d<double, gauss4>{}});
+    std::cout << std::endl;
+    std::cout << "nodal_qubic_serendipity:" << std::endl;
+    element_2d_integrate_test(element_2d_integrate<double, nodal_qubic_serendipity>{quadrature_1d<double, gauss4>{}});
+    std::cout << std::endl;
+    std::cout << "nodal_quartic_serendipity:" << std::endl;
+    element_2d_integrate_test(element_2d_integrate<double, nodal_quartic_serendipity>{quadrature_1d<double, gauss4>{}});
+    std::cout << std::endl;
+    std::cout << "nodal_quintic_serendipity:" << std::endl;
+    element_2d_integrate_test(element_2d_integrate<double, nodal_quintic_serendipity>{quadrature_1d<double, gauss5>{}});
+
+    std::cout << std::endl << std::endl;
+
+    // element_1d_integrate<T, Element_Type, Eval_T>, element_2d_integrate<T, Element_Type, Eval_T>
+    // Eval_T --- тип, в котором вычисляются функции формы при построении таблиц; веса и таблицы хранятся в типе T
+    std::cout << "MIXED_PRECISION_TEST: " << std::endl;
+    std::cout << "linear: " << std::endl;
+    mixed_precision_1d_test(element_1d_integrate<double, linear       >{quadrature_1d<double, gauss1>{}},
+                            element_1d_integrate<double, linear, float>{quadrature_1d<double, gauss1>{}});
+    std::cout << std::endl;
+    std::cout << "Quadratic: " << std::endl;
+    mixed_precision_1d_test(element_1d_integrate<double, quadratic       >{quadrature_1d<double, gauss2>{}},
+                            element_1d_integrate<double, quadratic, float>{quadrature_1d<double, gauss2>{}});
+    std::cout << std::endl;
+    std::cout << "Qubic: " << std::endl;
+    mixed_precision_1d_test(element_1d_integrate<double, qubic       >{quadrature_1d<double, gauss2>{}},
+                            element_1d_integrate<double, qubic, float>{quadrature_1d<double, gauss2>{}});
+    std::cout << std::endl;
+    std::cout << "triangle:" << std::endl;
+    mixed_precision_2d_test(element_2d_integrate<double, triangle       >{quadrature_1d<double, gauss2>{}},
+                            element_2d_integrate<double, triangle, float>{quadrature_1d<double, gauss2>{}});
+    std::cout << std::endl;
+    std::cout << "quadratic_triangle:" << std::endl;
+    mixed_precision_2d_test(element_2d_integrate<double, quadratic_triangle       >{quadrature_1d<double, gauss3>{}},
+                            element_2d_integrate<double, quadratic_triangle, float>{quadrature_1d<double, gauss3>{}});
+    std::cout << std::endl;
+    std::cout << "bilinear:" << std::endl;
+    mixed_precision_2d_test(element_2d_integrate<double, bilinear       >{quadrature_1d<double, gauss2>{}},
+                            element_2d_integrate<double, bilinear, float>{quadrature_1d<double, gauss2>{}});
+    std::cout << std::endl;
+    std::cout << "quadratic_serendipity:" << std::endl;
+    mixed_precision_2d_test(element_2d_integrate<double, quadratic_serendipity       >{quadrature_1d<double, gauss3>{}},
+                            element_2d_integrate<double, quadratic_serendipity, float>{quadrature_1d<double, gauss3>{}});
+    std::cout << std::endl;
+    std::cout << "quadratic_lagrange:" << std::endl;
+    mixed_precision_2d_test(element_2d_integrate<double, quadratic_lagrange       >{quadrature_1d<double, gauss3>{}},
+                            element_2d_integrate<double, quadratic_lagrange, float>{quadrature_1d<double, gauss3>{}});
+
+    std::cout << std::endl << std::endl;
+
+    // static_element_1d_integrate<T, Element_Type, Quadrature_Type>, static_element_2d_integrate<T, Element_Type, Quadrature_Type>
+    // Количество узлов и квадратурных точек известно на этапе компиляции, интерфейс не содержит виртуальных функций.
+    // static_element_1d_adapter, static_element_2d_adapter позволяют передать такой элемент в код, работающий с базовыми классами.
+    std::cout << "STATIC_ELEMENT_TEST: " << std::endl;
+    std::cout << "Qubic: " << std::endl;
+    static_assert(static_element_1d_integrate<double, qubic, gauss2>::nodes_count() == 4);
+    element_1d_integrate_test(static_element_1d_adapter{static_element_1d_integrate<double, qubic, gauss2>{}});
+    std::cout << std::endl;
+    std::cout << "quadratic_serendipity:" << std::endl;
+    static_assert(static_element_2d_integrate<double, quadratic_serendipity, gauss3>::qnodes_count() == 9);
+    element_2d_integrate_test(static_element_2d_adapter{static_element_2d_integrate<double, quadratic_serendipity, gauss3>{}});
+
+    std::cout << std::endl << std::endl;
+
+    // tabulate(points, mask, out) --- вычисление функций формы и их производных сразу во всём наборе точек
+    std::cout << "TABULATE_TEST: " << std::endl;
+    const std::vector<std::array<double, 2>> points = { {0.1, 0.2}, {0.3, 0.4}, {-0.5, 0.25}, {0.7, -0.9} };
+    std::cout << "quadratic_triangle:" << std::endl;
+    tabulate_2d_test(element_2d_integrate<double, quadratic_triangle>{quadrature_1d<double, gauss3>{}}, points);
+    std::cout << "quadratic_serendipity:" << std::endl;
+    tabulate_2d_test(element_2d_integrate<double, quadratic_serendipity>{quadrature_1d<double, gauss3>{}}, points);
+
+    std::cout << std::endl << std::endl;
+
+    // table_layout --- размещение таблиц в памяти: NODE_MAJOR, QUADRATURE_MAJOR, INTERLEAVED
+    // Строки таблиц выровнены по 64 байта, доступ к строкам и столбцам через qN_row(i), qN_column(q) и т.д.
+    std::cout << "TABLE_LAYOUT_TEST: " << std::endl;
+    for(const table_layout layout : {table_layout::NODE_MAJOR, table_layout::QUADRATURE_MAJOR, table_layout::INTERLEAVED}) {
+        const element_2d_integrate<double, quadratic_lagrange> element{quadrature_1d<double, gauss3>{}, layout};
+        double area = 0;
+        for(size_t q = 0; q < element.qnodes_count(); ++q) {
+            const strided_span<const double> column = element.qN_column(q);
+            for(size_t i = 0; i < column.size(); ++i)
+                area += element.weight(q) * column[i];
+        }
+        std::cout << "layout " << size_t(layout) << ": area = " << area << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // Табуляции элементов одного типа с одинаковыми квадратурами и параметрами разделяются через tabulation_registry<T>
+    std::cout << "SHARED_TABULATION_TEST: " << std::endl;
+    const std::vector<element_2d_integrate<double, bilinear>> elements(100, element_2d_integrate<double, bilinear>{quadrature_1d<double, gauss2>{}});
+    std::cout << "elements count: " << elements.size() << std::endl
+              << "tabulation references: " << elements.front().shared_tabulation().use_count() << std::endl;
+
+    std::cout << std::endl << std::endl;
+
+    // Таблицы серендиповых элементов хранятся в виде A + p B, поэтому смена параметра не требует вычисления функций формы
+    std::cout << "SERENDIPITY_PARAMETER_TEST: " << std::endl;
+    element_2d_integrate<double, quadratic_serendipity> serendipity{quadrature_1d<double, gauss3>{}};
+    for(const double p : {-1. / 3., 0., 2. / 9., 0.5}) {
+        serendipity.set_parameter(p);
+        double corner = 0; // Интеграл от угловой функции формы равен p
+        for(size_t q = 0; q < serendipity.qnodes_count(); ++q)
+            corner += serendipity.weight(q) * serendipity.qN(0, q);
+        std::cout << "p = " << p << ": integral of N_0 = " << corner << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // serendipity_parameter<T, Element_Type>::optimal<Quadrature_Type>() --- параметр, минимизирующий след матрицы жёсткости
+    // Результат выводится в виде, пригодном для подстановки в качестве значения по умолчанию
+    std::cout << "SERENDIPITY_OPTIMAL_PARAMETER_TEST: " << std::endl;
+    const auto precision = std::cout.precision(std::numeric_limits<double>::max_digits10);
+    std::cout << "quadratic_serendipity: T _p = T{" << serendipity_parameter<double, quadratic_serendipity>::optimal<gauss3>() << "}; // 2/9" << std::endl;
+    std::cout << "qubic_serendipity: T _p = T{" << serendipity_parameter<double, qubic_serendipity>::optimal<gauss4>() << "}; // 1/8" << std::endl;
+    std::cout.precision(precision);
+
+    std::cout << std::endl << std::endl;
+
+    // Статические таблицы элементов строятся при первом обращении. При сборке с опцией METAMATH_STARTUP_PROFILING
+    // время их построения накапливается по типам элементов, иначе отчёт пуст
+    // Таблицы вторых производных строятся только по запросу и хранятся в том же размещении, что и остальные таблицы
+    std::cout << "SECOND_DERIVATIVES_TEST: " << std::endl;
+    {
+        element_2d_integrate<double, quadratic_lagrange> element{quadrature_1d<double, gauss3>{}};
+        element.set_second_derivatives(true);
+        element.set_quadrature(quadrature_1d<double, gauss3>{}, quadrature_1d<double, gauss3>{});
+        double sum_dxixi = 0, sum_dxieta = 0, sum_detaeta = 0;
+        for(size_t i = 0; i < element.nodes_count(); ++i)
+            for(size_t q = 0; q < element.qnodes_count(); ++q) {
+                sum_dxixi   += element.weight(q) * element.qNxixi  (i, q);
+                sum_dxieta  += element.weight(q) * element.qNxieta (i, q);
+                sum_detaeta += element.weight(q) * element.qNetaeta(i, q);
+            }
+        std::cout << "tables count: " << element.shared_tabulation()->components_count() << std::endl
+                  << "sum_dxixi   = " << sum_dxixi   << std::endl
+                  << "sum_dxieta  = " << sum_dxieta  << std::endl
+                  << "sum_detaeta = " << sum_detaeta << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // Табуляции на сторонах элемента для интегралов по границе: веса включают якобиан стороны
+    std::cout << "EDGE_TABULATION_TEST: " << std::endl;
+    {
+        element_2d_integrate<double, quadratic_triangle> element{quadrature_1d<double, gauss3>{}};
+        element.set_edge_quadrature(quadrature_1d<double, gauss3>{});
+        for(const side_2d side : {side_2d::LEFT, side_2d::DOWN, side_2d::UP}) {
+            double length = 0, sum = 0;
+            for(size_t q = 0; q < element.edge_qnodes_count(side); ++q) {
+                length += element.edge_weight(side, q);
+                for(size_t i = 0; i < element.nodes_count(); ++i)
+                    sum += element.edge_weight(side, q) * element.edge_qN(side, i, q);
+            }
+            std::cout << "side " << size_t(side) << ": length = " << length << ", integral of sum N_i = " << sum
+                      << ", normal = (" << element.edge_normal(side)[0] << ", " << element.edge_normal(side)[1] << ")" << std::endl;
+        }
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // Матрицы эталонного элемента вычисляются один раз, а матрицы аффинных элементов получаются их линейной комбинацией
+    std::cout << "REFERENCE_MATRICES_TEST: " << std::endl;
+    {
+        const element_2d_integrate<double, bilinear> element{quadrature_1d<double, gauss2>{}};
+        const auto matrices = element.shared_reference_matrices();
+        const std::array<std::array<double, 2>, 2> jacobian = {{{2, 0.5}, {0, 1}}}; // Параллелограмм, dx/dxi
+        const double det = jacobian[0][0] * jacobian[1][1] - jacobian[0][1] * jacobian[1][0];
+        const size_t n = matrices->nodes_count();
+        std::vector<double> mass(reference_matrices<double>::packed_size(n)), stiffness(mass.size());
+        matrices->element_mass(std::abs(det), mass.data());
+        matrices->element_stiffness(reference_matrices<double>::stiffness_factors(jacobian).data(), stiffness.data());
+
+        double area = 0, difference = 0;
+        for(size_t i = 0; i < n; ++i)
+            for(size_t j = 0; j < n; ++j) {
+                area += mass[reference_matrices<double>::packed_index(i, j, n)];
+                double direct = 0; // Интегрирование по квадратуре с градиентами J^{-T} grad N
+                for(size_t q = 0; q < element.qnodes_count(); ++q) {
+                    const std::array<double, 2> gi = {( jacobian[1][1] * element.qNxi(i, q) - jacobian[1][0] * element.qNeta(i, q)) / det,
+                                                      (-jacobian[0][1] * element.qNxi(i, q) + jacobian[0][0] * element.qNeta(i, q)) / det},
+                                                gj = {( jacobian[1][1] * element.qNxi(j, q) - jacobian[1][0] * element.qNeta(j, q)) / det,
+                                                      (-jacobian[0][1] * element.qNxi(j, q) + jacobian[0][0] * element.qNeta(j, q)) / det};
+                    direct += element.weight(q) * std::abs(det) * (gi[0] * gj[0] + gi[1] * gj[1]);
+                }
+                difference = std::max(difference, std::abs(direct - stiffness[reference_matrices<double>::packed_index(i, j, n)]));
+            }
+        std::cout << "area = " << area << std::endl
+                  << "max stiffness difference = " << difference << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // Слабая постановка записывается выражением и собирается одним ядром по таблицам статического элемента
+    std::cout << "WEAK_FORM_TEST: " << std::endl;
+    {
+        using namespace weak_form;
+        const static_element_2d_integrate<double, quadratic_serendipity, gauss3> element;
+        constexpr size_t n = element.nodes_count();
+        const bilinear_form_2d<double> form{2.0 * dot(grad(u), grad(v)) + 0.5 * u * v};
+        const linear_form_2d<double> load{3.0 * v};
+        const std::array<std::array<double, 2>, 2> jacobian = {{{2, 0.5}, {0, 1}}};
+        const std::array<double, 2> b = {1.5, -0.5};
+        const bilinear_form_2d<double> convection{dot(b, grad(u)) * v}; // Несимметричная форма
+        std::array<double, n * n> matrix, convection_matrix;
+        std::array<double, n> vector;
+        form.assemble(element, jacobian, matrix);
+        convection.assemble(element, jacobian, convection_matrix);
+        load.assemble(element, jacobian, vector);
+
+        // Прямая сборка по таблицам элемента с градиентами J^{-T} grad N, строка i --- тестовая функция, столбец j --- пробная
+        const double det = jacobian[0][0] * jacobian[1][1] - jacobian[0][1] * jacobian[1][0];
+        const auto gradient = [&element, &jacobian, det](const size_t i, const size_t q) {
+            return std::array<double, 2>{( jacobian[1][1] * element.qNxi()[i * element.qnodes_count() + q] -
+                                           jacobian[1][0] * element.qNeta()[i * element.qnodes_count() + q]) / det,
+                                         (-jacobian[0][1] * element.qNxi()[i * element.qnodes_count() + q] +
+                                           jacobian[0][0] * element.qNeta()[i * element.qnodes_count() + q]) / det};
+        };
+        double sum = 0, difference = 0, convection_difference = 0;
+        for(size_t i = 0; i < n; ++i) {
+            sum += vector[i];
+            for(size_t j = 0; j < n; ++j) {
+                double direct = 0, convection_direct = 0;
+                for(size_t q = 0; q < element.qnodes_count(); ++q) {
+                    const double weight = element.weights()[q] * std::abs(det),
+                                 Ni = element.qN()[i * element.qnodes_count() + q], Nj = element.qN()[j * element.qnodes_count() + q];
+                    const std::array<double, 2> gi = gradient(i, q), gj = gradient(j, q);
+                    direct += weight * (2.0 * (gj[0] * gi[0] + gj[1] * gi[1]) + 0.5 * Nj * Ni);
+                    convection_direct += weight * (b[0] * gj[0] + b[1] * gj[1]) * Ni;
+                }
+                difference = std::max(difference, std::abs(direct - matrix[i * n + j]));
+                convection_difference = std::max(convection_difference, std::abs(convection_direct - convection_matrix[i * n + j]));
+            }
+        }
+        std::cout << "max difference = " << difference << std::endl
+                  << "max convection difference = " << convection_difference << std::endl
+                  << "load sum = " << sum << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // Элементы-тензорные произведения хранят только одномерные таблицы, а интерполяция выполняется сумм-факторизацией
+    std::cout << "TENSOR_PRODUCT_TEST: " << std::endl;
+    {
+        const tensor_element_2d_integrate<double, quadratic_lagrange> element{quadrature_1d<double, gauss5>{}};
+        const element_2d_integrate<double, quadratic_lagrange> full{quadrature_1d<double, gauss5>{}};
+        std::vector<double> u(element.nodes_count()), values(element.qnodes_count()), workspace(element.workspace_size());
+        for(size_t i = 0; i < element.nodes_count(); ++i) // Интерполяция функции x^2 + y
+            u[i] = element.node(i)[0] * element.node(i)[0] + element.node(i)[1];
+        element.interpolate(u.data(), values.data(), nullptr, nullptr, workspace.data());
+        double integral = 0;
+        for(size_t q = 0; q < element.qnodes_count(); ++q)
+            integral += element.weight(q) * values[q];
+        std::cout << "tables size: " << element.tables_size() << " (full: " << full.shared_tabulation()->size() << ")" << std::endl
+                  << "integral of x^2 + y = " << integral << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // Безматричный оператор на сетке m x m элементов порядка p единичного квадрата: x^T M 1 --- площадь, u^T K u для u = x --- единица
+    std::cout << "MATRIX_FREE_OPERATOR_TEST: " << std::endl;
+    {
+        const size_t p = 3, m = 4, n = p + 1, side = m * p + 1;
+        const element_1d<double, lagrange> factor{p};
+        const auto basis = element_1d_integrate<double, lagrange>{quadrature_1d<double, gauss5>{}, p}.shared_tabulation();
+        std::vector<size_t> dofs;
+        std::vector<std::array<std::array<double, 2>, 2>> jacobians(m * m, {{{0.5 / m, 0}, {0, 0.5 / m}}});
+        std::vector<double> ones(side * side, 1.0), u(side * side), y, workspace;
+        for(size_t ex = 0; ex < m; ++ex)
+            for(size_t ey = 0; ey < m; ++ey)
+                for(size_t i = 0; i < n; ++i)
+                    for(size_t j = 0; j < n; ++j) {
+                        dofs.push_back((ex * p + i) * side + ey * p + j);
+                        u[dofs.back()] = (ex + (factor.node(i) + 1) / 2) / m;
+                    }
+        const matrix_free_operator_2d<double> mass{*basis, side * side, dofs, jacobians, 1, 0}, laplace{*basis, side * side, dofs, jacobians};
+        mass(ones, y, workspace);
+        double area = 0, energy = 0;
+        for(const double value : y)
+            area += value;
+        laplace(u, y, workspace);
+        for(size_t k = 0; k < y.size(); ++k)
+            energy += u[k] * y[k];
+        std::cout << "area = " << area << std::endl
+                  << "energy = " << energy << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    // Иерархические элементы: при повышении порядка таблицы достраиваются, а базис меньшего порядка остаётся в начале базиса
+    std::cout << "HIERARCHICAL_ELEMENT_TEST: " << std::endl;
+    {
+        element_2d_integrate<double, hierarchical_quadrilateral> element{quadrature_1d<double, gauss5>{}, size_t{1}};
+        for(const size_t order : {1, 2, 3, 4}) {
+            element.set_order(order);
+            double area = 0, energy = 0; // Энергия внутренних функций последнего уровня
+            for(size_t q = 0; q < element.qnodes_count(); ++q) {
+                area += element.weight(q) * element.qN(0, q);
+                energy += element.weight(q) * (element.qNxi (element.nodes_count() - 1, q) * element.qNxi (element.nodes_count() - 1, q) +
+                                               element.qNeta(element.nodes_count() - 1, q) * element.qNeta(element.nodes_count() - 1, q));
+            }
+            std::cout << "order " << order << ": nodes = " << element.nodes_count() << ", integral N_0 = " << area
+                      << ", energy of the last function = " << energy << std::endl;
+        }
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "DUBINER_TRIANGLE_TEST: " << std::endl;
+    {
+        const size_t order = 4; // gauss5 точна для многочленов степени 9, поэтому матрица массы вычисляется точно
+        const element_2d_integrate<double, dubiner_triangle> element{quadrature_1d<double, gauss5>{}, order};
+        double off_diagonal = 0; // Наибольший внедиагональный элемент матрицы массы
+        for(size_t i = 0; i < element.nodes_count(); ++i)
+            for(size_t j = 0; j < i; ++j) {
+                double mass = 0;
+                for(size_t q = 0; q < element.qnodes_count(); ++q)
+                    mass += element.weight(q) * element.qN(i, q) * element.qN(j, q);
+                off_diagonal = std::max(off_diagonal, std::abs(mass));
+            }
+        const dubiner_triangle_2d_integrate<double> collapsed{quadrature_1d<double, gauss5>{}, order};
+        std::vector<double> u(collapsed.nodes_count(), 0), values(collapsed.qnodes_count()), workspace(collapsed.workspace_size());
+        u.front() = std::sqrt(2.0); // psi_00 = sqrt(2), поэтому u_h = 2
+        collapsed.interpolate(u.data(), values.data(), nullptr, nullptr, workspace.data());
+        double area = 0;
+        for(size_t q = 0; q < collapsed.qnodes_count(); ++q)
+            area += collapsed.weight(q) * values[q];
+        std::cout << "nodes = " << element.nodes_count() << ", max off-diagonal mass = " << off_diagonal << std::endl
+                  << "integral of u_h = " << area << ", tables size: " << collapsed.tables_size()
+                  << " vs " << 3 * element.nodes_count() * element.qnodes_count() << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "STATIC_CONDENSATION_TEST: " << std::endl;
+    {
+        // Матрица задачи -laplace(u) + u = 1 на элементе четвёртого порядка, её решение u = 1
+        const element_2d_integrate<double, hierarchical_quadrilateral> element{quadrature_1d<double, gauss5>{}, size_t{4}};
+        const size_t n = element.nodes_count();
+        std::vector<double> matrix(n * n, 0), load(n, 0);
+        for(size_t i = 0; i < n; ++i)
+            for(size_t q = 0; q < element.qnodes_count(); ++q) {
+                load[i] += element.weight(q) * element.qN(i, q);
+                for(size_t j = 0; j < n; ++j)
+                    matrix[i * n + j] += element.weight(q) * (element.qN  (i, q) * element.qN  (j, q) +
+                                                              element.qNxi(i, q) * element.qNxi(j, q) + element.qNeta(i, q) * element.qNeta(j, q));
+            }
+        const static_condensation<double> condensation{n, element.interior_nodes()};
+        const condensed_element<double> condensed = condensation.condense(matrix.data(), load.data());
+        std::vector<double> boundary_values(condensation.boundary().size(), 0), values(n);
+        boundary_values.front() = boundary_values[1] = boundary_values[2] = boundary_values[3] = 1; // Значения в вершинах
+        condensation.recover(condensed, boundary_values.data(), values.data());
+        double residual = 0; // Невязка конденсированной системы на точном решении
+        for(size_t r = 0; r < boundary_values.size(); ++r) {
+            double sum = -condensed.load[r];
+            for(size_t c = 0; c < boundary_values.size(); ++c)
+                sum += condensed.matrix[r * boundary_values.size() + c] * boundary_values[c];
+            residual = std::max(residual, std::abs(sum));
+        }
+        double interior = 0; // Коэффициенты внутренних функций решения u = 1 равны нулю
+        for(const size_t i : condensation.interior())
+            interior = std::max(interior, std::abs(values[i]));
+        std::cout << "nodes = " << n << ", condensed = " << condensation.boundary().size() << ", residual = " << residual
+                  << ", max interior coefficient = " << interior << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "AFFINE_ELEMENT_TEST: " << std::endl;
+    {
+        const element_2d_integrate<double, triangle> element{quadrature_1d<double, gauss3>{}};
+        double reference_area = 0;
+        for(size_t q = 0; q < element.qnodes_count(); ++q)
+            reference_area += element.weight(q);
+        // Энергия функции u = x на треугольной сетке единичного квадрата: одна матрица Якоби и один набор градиентов на элемент
+        const size_t m = 4;
+        double area = 0, energy = 0;
+        for(size_t i = 0; i < m; ++i)
+            for(size_t j = 0; j < m; ++j) {
+                const double x = double(i) / m, y = double(j) / m, h = 1.0 / m;
+                for(const std::vector<std::array<double, 2>>& coordinates : {std::vector<std::array<double, 2>>{{x + h, y}, {x, y + h}, {x, y}},
+                                                                             std::vector<std::array<double, 2>>{{x, y + h}, {x + h, y}, {x + h, y + h}}}) {
+                    const affine_map_2d<double> map = *affine_mapping(element, coordinates);
+                    const std::vector<std::array<double, 2>> gradients = constant_gradients(element, map);
+                    std::array<double, 2> gradient = {};
+                    for(size_t k = 0; k < element.nodes_count(); ++k)
+                        for(size_t a = 0; a < 2; ++a)
+                            gradient[a] += coordinates[k][0] * gradients[k][a];
+                    const double measure = std::abs(map.determinant()) * reference_area;
+                    area += measure;
+                    energy += measure * (gradient[0] * gradient[0] + gradient[1] * gradient[1]);
+                }
+            }
+        const element_2d<double, bilinear> quadrilateral;
+        std::cout << "area = " << area << ", energy = " << energy << std::endl
+                  << "parallelogram is affine: " << affine_mapping(quadrilateral, {{0, 0}, {2, 0}, {3, 1}, {1, 1}}).has_value()
+                  << ", trapezoid is affine: " << affine_mapping(quadrilateral, {{0, 0}, {2, 0}, {1.5, 1}, {0.5, 1}}).has_value() << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "TABULATION_CACHE_TEST: " << std::endl;
+    {
+        // Табуляции сохраняются в кэше на диске и при следующих запусках отображаются в память без вычисления функций формы
+        const auto cache = std::make_shared<const tabulation_cache<double>>(std::filesystem::temp_directory_path() / "metamath_tabulations");
+        const element_2d_integrate<double, nodal_quartic_serendipity> element{cache, quadrature_1d<double, gauss5>{}};
+        double area = 0;
+        for(size_t i = 0; i < element.nodes_count(); ++i)
+            for(size_t q = 0; q < element.qnodes_count(); ++q)
+                area += element.weight(q) * element.qN(i, q);
+        std::cout << "file: " << cache->path({typeid(element_2d_integrate<double, nodal_quartic_serendipity>),
+                                              {typeid(quadrature_1d<double, gauss5>), typeid(quadrature_1d<double, gauss5>)},
+                                              {}, table_layout::NODE_MAJOR}).filename() << std::endl
+                  << "area = " << area << std::endl;
+    }
+
+    std::cout << std::endl << std::endl;
+
+    std::cout << "STARTUP_PROFILE: " << std::endl;
+    initialization_profile::instance().report(std::cout);
+
     return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -4,5 +4,7 @@
 #include "linear.hpp"
 #include "quadratic.hpp"
 #include "qubic.hpp"
+#include "lagrange.hpp"
+#include "hierarchical.hpp"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef FINITE_ELEMENT_1D_BASIS_HIERARCHICAL_ELEMENT_HPP
+#define FINITE_ELEMENT_1D_BASIS_HIERARCHICAL_ELEMENT_HPP
+
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+#include "geometry_1d.hpp"
+#include "legendre.hpp"
+
+namespace metamath::finite_element {
+
+// Иерархический элемент на интегрированных многочленах Лежандра, порядок которого задаётся во время выполнения программы:
+// N_0 = (1 - x) / 2, N_1 = (1 + x) / 2, N_k = sqrt((2k - 1) / 2) int_{-1}^{x} P_{k-1}(t) dt = (P_k - P_{k-2}) / sqrt(2 (2k - 1)), k = 2..p.
+// Базис порядка p содержит базис порядка p - 1, поэтому при повышении порядка добавляются только новые функции.
+// Внутренние функции N_k, k >= 2, обращаются в ноль на концах отрезка и условно относятся к его середине.
+template<class T>
+class hierarchical : public geometry_1d<T, standart_segment_geometry> {
+public:
+    size_t order() const noexcept { return _order; }
+
+    // Условная координата функции k: концы отрезка для вершинных функций и середина для внутренних.
+    static constexpr T mode_node(const size_t k) noexcept { return k == 0 ? T{-1} : k == 1 ? T{1} : T{0}; }
+
+    // Значения функций N_first, ..., N_order и их первых и вторых производных в точке x, вычисленные в типе Eval_T:
+    // N[k*stride], Nxi[k*stride], Nxixi[k*stride]. Функции с номерами меньше first и нулевые указатели пропускаются.
+    template<class Eval_T>
+    static void evaluate(const size_t order, const T x, T* const N, T* const Nxi, const size_t stride,
+                         T* const Nxixi = nullptr, const size_t first = 0) {
+        std::vector<Eval_T> P(order + 1), dP(order + 1);
+        function::legendre_values(order, static_cast<Eval_T>(x), P.data(), Nxixi ? dP.data() : nullptr);
+        for(size_t k = first; k <= order; ++k) {
+            if (k < 2) {
+                const Eval_T sign = k ? Eval_T{1} : Eval_T{-1};
+                if (N)     N    [k*stride] = static_cast<T>((Eval_T{1} + sign * static_cast<Eval_T>(x)) / Eval_T{2});
+                if (Nxi)   Nxi  [k*stride] = static_cast<T>(sign / Eval_T{2});
+                if (Nxixi) Nxixi[k*stride] = T{0};
+                continue;
+            }
+            const Eval_T scale = std::sqrt(Eval_T(2*k - 1) / Eval_T{2});
+            if (N)     N    [k*stride] = static_cast<T>((P[k] - P[k-2]) * scale / Eval_T(2*k - 1));
+            if (Nxi)   Nxi  [k*stride] = static_cast<T>(scale * P[k-1]);
+            if (Nxixi) Nxixi[k*stride] = static_cast<T>(scale * dP[k-1]);
+        }
+    }
+
+protected:
+    size_t _order;
+
+    explicit hierarchical(const size_t order)
+        : _order{order} {
+        if (order == 0)
+            throw std::domain_error{"The order of hierarchical element must be positive."};
+    }
+
+    ~hierarchical() override = default;
+
+    void set_order(const size_t order) {
+        if (order == 0)
+            throw std::domain_error{"The order of hierarchical element must be positive."};
+        _order = order;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,137 @@
+#ifndef FINITE_ELEMENT_1D_BASIS_LAGRANGE_ELEMENT_HPP
+#define FINITE_ELEMENT_1D_BASIS_LAGRANGE_ELEMENT_HPP
+
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+#include "geometry_1d.hpp"
+
+namespace metamath::finite_element {
+
+// Распределение узлов лагранжевых элементов произвольного порядка.
+// Узлы Гаусса-Лобатто (концы отрезка и корни производной полинома Лежандра) обеспечивают устойчивость интерполяции высоких порядков.
+enum class lagrange_nodes : uint8_t { EQUISPACED, GAUSS_LOBATTO };
+
+// Лагранжев элемент, порядок которого задаётся во время выполнения программы.
+// Функции формы и их производные вычисляются по барицентрической формуле Лагранжа:
+// N_j(x) = (w_j / (x - x_j)) / sum_k w_k / (x - x_k), w_j = 1 / prod_{k != j} (x_j - x_k),
+// что требует O(p) действий на точку для всех функций формы сразу и численно устойчиво.
+template<class T>
+class lagrange : public geometry_1d<T, standart_segment_geometry> {
+public:
+    size_t order() const noexcept { return _nodes.size() - 1; }
+    lagrange_nodes distribution() const noexcept { return _distribution; }
+
+protected:
+    std::vector<T> _nodes, _weights; // Узлы и барицентрические веса.
+    lagrange_nodes _distribution;
+
+    explicit lagrange(const size_t order, const lagrange_nodes distribution = lagrange_nodes::GAUSS_LOBATTO)
+        : _nodes(order + 1)
+        , _weights(order + 1)
+        , _distribution{distribution} {
+        if (order == 0)
+            throw std::domain_error{"The order of lagrange element must be positive."};
+        _nodes.front() = T{-1};
+        _nodes.back()  = T{ 1};
+        for(size_t k = 1; k < order; ++k)
+            _nodes[k] = 2 * k == order ? T{0} : // Центральный узел задаётся точно
+                        distribution == lagrange_nodes::EQUISPACED ? T{-1} + T(2 * k) / T(order) : lobatto_node(order, k);
+        for(size_t j = 0; j <= order; ++j) {
+            long double product = 1;
+            for(size_t k = 0; k <= order; ++k)
+                if (k != j)
+                    product *= static_cast<long double>(_nodes[j]) - static_cast<long double>(_nodes[k]);
+            _weights[j] = static_cast<T>(1 / product);
+        }
+    }
+
+    ~lagrange() override = default;
+
+    // Значения всех функций формы и их первых и вторых производных в точке x, вычисленные в типе Eval_T:
+    // N[j*stride], Nxi[j*stride], Nxixi[j*stride]. Таблицы, для которых передан нулевой указатель, не вычисляются.
+    template<class Eval_T>
+    void evaluate(const T x, T* const N, T* const Nxi, const size_t stride, T* const Nxixi = nullptr) const {
+        const size_t size = _nodes.size();
+        for(size_t m = 0; m < size; ++m)
+            if (static_cast<Eval_T>(x) == static_cast<Eval_T>(_nodes[m])) {
+                // В узле x_m: N_j = delta_jm, N_j' = D_j = (w_j / w_m) / (x_m - x_j), N_j'' = 2 D_j (D_m - 1 / (x_m - x_j)),
+                // а значения для j = m находятся из того, что сумма производных функций формы равна нулю.
+                const auto derivative = [this, m](const size_t j) {
+                    return static_cast<Eval_T>(_weights[j]) / static_cast<Eval_T>(_weights[m]) /
+                           (static_cast<Eval_T>(_nodes[m]) - static_cast<Eval_T>(_nodes[j]));
+                };
+                Eval_T diagonal = Eval_T{0};
+                for(size_t j = 0; j < size; ++j)
+                    if (j != m)
+                        diagonal -= derivative(j);
+                Eval_T second_diagonal = Eval_T{0};
+                for(size_t j = 0; j < size; ++j) {
+                    if (N)
+                        N[j*stride] = T(j == m);
+                    if (j == m)
+                        continue;
+                    const Eval_T first = derivative(j),
+                                 second = Eval_T{2} * first * (diagonal - Eval_T{1} / (static_cast<Eval_T>(_nodes[m]) - static_cast<Eval_T>(_nodes[j])));
+                    if (Nxi)
+                        Nxi[j*stride] = static_cast<T>(first);
+                    if (Nxixi)
+                        Nxixi[j*stride] = static_cast<T>(second);
+                    second_diagonal -= second;
+                }
+                if (Nxi)
+                    Nxi[m*stride] = static_cast<T>(diagonal);
+                if (Nxixi)
+                    Nxixi[m*stride] = static_cast<T>(second_diagonal);
+                return;
+            }
+
+        Eval_T s = Eval_T{0}, s2 = Eval_T{0}, s3 = Eval_T{0};
+        for(size_t k = 0; k < size; ++k) {
+            const Eval_T d = static_cast<Eval_T>(x) - static_cast<Eval_T>(_nodes[k]), t = static_cast<Eval_T>(_weights[k]) / d;
+            s  += t;
+            s2 += t / d;
+            s3 += t / (d * d);
+        }
+        // N_j' = N_j g_j, g_j = s2 / s - 1 / (x - x_j), где s = sum_k w_k / (x - x_k), s2 = sum_k w_k / (x - x_k)^2;
+        // N_j'' = N_j (g_j^2 + g_j'), g_j' = (s2 / s)^2 - 2 s3 / s + 1 / (x - x_j)^2, s3 = sum_k w_k / (x - x_k)^3.
+        const Eval_T ratio = s2 / s, second_ratio = ratio * ratio - Eval_T{2} * s3 / s;
+        for(size_t j = 0; j < size; ++j) {
+            const Eval_T d = static_cast<Eval_T>(x) - static_cast<Eval_T>(_nodes[j]), value = static_cast<Eval_T>(_weights[j]) / d / s,
+                         g = ratio - Eval_T{1} / d;
+            if (N)
+                N[j*stride] = static_cast<T>(value);
+            if (Nxi)
+                Nxi[j*stride] = static_cast<T>(value * g);
+            if (Nxixi)
+                Nxixi[j*stride] = static_cast<T>(value * (g * g + second_ratio + Eval_T{1} / (d * d)));
+        }
+    }
+
+private:
+    // k-ый внутренний узел Гаусса-Лобатто порядка n --- корень P_n'(x), найденный методом Ньютона.
+    // Начальное приближение --- узел Чебышёва-Гаусса-Лобатто, производные полинома Лежандра вычисляются по рекуррентным соотношениям.
+    static T lobatto_node(const size_t n, const size_t k) {
+        const long double pi = 3.141592653589793238462643383279502884l;
+        long double x = -std::cos(pi * k / n);
+        for(size_t iteration = 0; iteration < 100; ++iteration) {
+            long double p_prev = 1, p = x;
+            for(size_t l = 2; l <= n; ++l) {
+                const long double p_next = ((2 * l - 1) * x * p - (l - 1) * p_prev) / l;
+                p_prev = p;
+                p = p_next;
+            }
+            const long double dp  = n * (p_prev - x * p) / (1 - x * x),
+                              d2p = (2 * x * dp - n * (n + 1) * p) / (1 - x * x),
+                              dx  = dp / d2p;
+            x -= dx;
+            if (std::abs(dx) < 1e-18l)
+                break;
+        }
+        return static_cast<T>(x);
+    }
+};
+
+}
+
+#endif
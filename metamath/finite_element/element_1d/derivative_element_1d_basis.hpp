@@ -2,7 +2,10 @@
 #define DERIVATIVE_FINITE_ELEMENT_1D_BASIS_HPP
 
 #include "derivative.hpp"
+#include "taylor.hpp"
 #include "to_function.hpp"
+#include "evaluate.hpp"
+#include "initialization_profile.hpp"
 
 namespace metamath::finite_element {
 
@@ -15,12 +18,62 @@ class derivative_element_1d_basis : public Element_Type<T> {
     static_assert(std::tuple_size<decltype(basis)>::value == nodes.size(), "The number of functions and nodes does not match.");
 
 protected:
-    static inline const std::array<std::function<T(const std::array<T, Parameters_Count>&)>, nodes.size()>
-        N   = symdiff::to_function<T, Parameters_Count>(basis),
-        Nxi = symdiff::to_function<T, Parameters_Count>(symdiff::derivative<xi>(basis));
+    using function_table = std::array<std::function<T(const std::array<T, Parameters_Count>&)>, nodes.size()>;
+
+    struct basis_functions final {
+        function_table N, Nxi;
+    };
+
+    // Функции формы и их производные строятся при первом обращении, а не при запуске программы.
+    // Инициализация локальной статической переменной потокобезопасна, последующие обращения не требуют блокировок.
+    static const basis_functions& functions() {
+        static const basis_functions table = profile_initialization<Element_Type<T>>([] {
+            return basis_functions{symdiff::to_function<T, Parameters_Count>(basis),
+                                   symdiff::to_function<T, Parameters_Count>(symdiff::derivative<xi>(basis))};
+        });
+        return table;
+    }
+
+    // Вторая производная i-ой функции формы получается разложением в ряд Тейлора (symdiff::taylor),
+    // поэтому символьные деревья вторых производных не строятся и не инстанцируются.
+    static T second_derivative(const size_t i, const std::array<T, Parameters_Count>& point) {
+        return second_derivative(i, point, std::make_index_sequence<nodes.size()>{});
+    }
 
     explicit derivative_element_1d_basis() = default;
     ~derivative_element_1d_basis() override = default;
+
+private:
+    template<size_t... I>
+    static T second_derivative(const size_t i, const std::array<T, Parameters_Count>& point, const std::index_sequence<I...>&) {
+        T result = T{0};
+        ((I == i && (result = symdiff::taylor<xi, 2>(std::get<I>(basis), point).derivative(2), true)) || ...);
+        return result;
+    }
+
+public:
+    // Пакетное вычисление функций формы и их производных в наборе точек, минуя обращение к std::function.
+    // Функции формы вычисляются в типе T, результат сохраняется в типе U по столбцам: N[i*points.size() + k].
+    // Таблицы, для которых передан нулевой указатель, не вычисляются.
+    template<class U>
+    static void tabulate(const std::vector<std::array<U, Parameters_Count>>& points, U* const N, U* const Nxi) {
+        if (N)   symdiff::evaluate<T>(basis, points, N);
+        if (Nxi) symdiff::evaluate<T>(symdiff::derivative<xi>(basis), points, Nxi);
+    }
+
+    // Вариант со вторыми производными, которые вычисляются функцией second_derivative.
+    template<class U>
+    static void tabulate(const std::vector<std::array<U, Parameters_Count>>& points, U* const N, U* const Nxi, U* const Nxixi) {
+        tabulate(points, N, Nxi);
+        if (Nxixi)
+            for(size_t i = 0; i < nodes.size(); ++i)
+                for(size_t k = 0; k < points.size(); ++k) {
+                    std::array<T, Parameters_Count> point;
+                    for(size_t d = 0; d < Parameters_Count; ++d)
+                        point[d] = static_cast<T>(points[k][d]);
+                    Nxixi[i * points.size() + k] = static_cast<U>(second_derivative(i, point));
+                }
+    }
 };
 
 }
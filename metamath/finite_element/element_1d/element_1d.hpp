@@ -1,6 +1,7 @@
 #ifndef FINITE_ELEMENT_1D_HPP
 #define FINITE_ELEMENT_1D_HPP
 
+#include <utility>
 #include "element_1d_base.hpp"
 #include "derivative_element_1d_basis.hpp"
 
@@ -16,14 +17,38 @@ class element_1d : public virtual element_1d_base<T>,
 public:
     ~element_1d() override = default;
 
-    size_t nodes_count() const override { return derivative_base::N.size(); }
+    size_t nodes_count() const override { return Element_Type<T>::nodes.size(); }
 
     T node(const size_t i) const override { return Element_Type<T>::nodes[i]; }
 
-    T N  (const size_t i, const T xi) const override { return derivative_base::N  [i]({xi}); }
-    T Nxi(const size_t i, const T xi) const override { return derivative_base::Nxi[i]({xi}); }
+    T N  (const size_t i, const T xi) const override { return derivative_base::functions().N  [i]({xi}); }
+    T Nxi(const size_t i, const T xi) const override { return derivative_base::functions().Nxi[i]({xi}); }
+    T Nxixi(const size_t i, const T xi) const override { return derivative_base::second_derivative(i, {xi}); }
 
     T boundary(const side_1d bound) const override { return Element_Type<T>::boundary(bound); }
+
+    void tabulate(const std::vector<T>& points, const derivative_1d mask, T* out) const override {
+        std::vector<std::array<T, 1>> xi(points.size());
+        for(size_t k = 0; k < points.size(); ++k)
+            xi[k][0] = points[k];
+        T* const N     = mask & derivative_1d::N    ? std::exchange(out, out + nodes_count() * points.size()) : nullptr;
+        T* const Nxi   = mask & derivative_1d::XI   ? std::exchange(out, out + nodes_count() * points.size()) : nullptr;
+        T* const Nxixi = mask & derivative_1d::XIXI ? out : nullptr;
+        tabulate_basis<T>(xi, N, Nxi, Nxixi);
+    }
+
+protected:
+    // Параметры элемента, от которых зависят функции формы. Используются для идентификации табуляций.
+    std::vector<T> parameters() const { return {}; }
+
+    // Пакетное вычисление функций формы в типе Eval_T, результат сохраняется в типе T.
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 1>>& points, T* const N, T* const Nxi, T* const Nxixi = nullptr) const {
+        if (Nxixi)
+            derivative_element_1d_basis<Eval_T, Element_Type, 1>::tabulate(points, N, Nxi, Nxixi);
+        else
+            derivative_element_1d_basis<Eval_T, Element_Type, 1>::tabulate(points, N, Nxi);
+    }
 };
 
 }
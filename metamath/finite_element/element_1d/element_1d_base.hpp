@@ -1,12 +1,27 @@
 #ifndef ELEMENT_1D_BASE_HPP
 #define ELEMENT_1D_BASE_HPP
 
+#include <cmath>
+#include <limits>
 #include <type_traits>
+#include <cstdint>
+#include <vector>
 #include "element_base.hpp"
 #include "geometry_1d.hpp"
 
 namespace metamath::finite_element {
 
+// Маска величин, вычисляемых при пакетном вычислении функций формы.
+enum class derivative_1d : uint8_t { N = 1, XI = 2, XIXI = 4 };
+
+constexpr derivative_1d operator|(const derivative_1d lhs, const derivative_1d rhs) noexcept {
+    return derivative_1d(uint8_t(lhs) | uint8_t(rhs));
+}
+
+constexpr bool operator&(const derivative_1d mask, const derivative_1d flag) noexcept {
+    return uint8_t(mask) & uint8_t(flag);
+}
+
 template<class T>
 class element_1d_base : public element_base {
     static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
@@ -18,10 +33,37 @@ public:
 
     virtual T N  (const size_t i, const T xi) const = 0; // Обращение к i-ой функции формы в точке xi.
     virtual T Nxi(const size_t i, const T xi) const = 0; // Аналогично для производной.
+    virtual T Nxixi(const size_t i, const T xi) const = 0; // Аналогично для второй производной.
 
     virtual T boundary(const side_1d bound) const = 0; // Геометрия элемента.
+
+    // Номера функций формы, которые обращаются в ноль на концах элемента и могут быть исключены статической конденсацией.
+    // Для узловых элементов это функции узлов, лежащих строго внутри элемента.
+    virtual std::vector<size_t> interior_nodes() const {
+        const T tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
+        std::vector<size_t> result;
+        for(size_t i = 0; i < nodes_count(); ++i)
+            if (node(i) > boundary(side_1d::LEFT) + tolerance && node(i) < boundary(side_1d::RIGHT) - tolerance)
+                result.push_back(i);
+        return result;
+    }
+
+    // Пакетное вычисление функций формы и их производных в наборе точек.
+    // Для каждой величины из маски в порядке N, XI, XIXI в out записывается блок размером nodes_count() * points.size()
+    // по столбцам: out[i*points.size() + k]. Наследники переопределяют метод, избегая обращения к функциям по одной.
+    virtual void tabulate(const std::vector<T>& points, const derivative_1d mask, T* out) const {
+        const auto fill = [this, &points, &out](const auto& function) {
+            for(size_t i = 0; i < nodes_count(); ++i)
+                for(size_t k = 0; k < points.size(); ++k)
+                    out[i*points.size() + k] = function(i, points[k]);
+            out += nodes_count() * points.size();
+        };
+        if (mask & derivative_1d::N)    fill([this](const size_t i, const T xi) { return N  (i, xi); });
+        if (mask & derivative_1d::XI)   fill([this](const size_t i, const T xi) { return Nxi(i, xi); });
+        if (mask & derivative_1d::XIXI) fill([this](const size_t i, const T xi) { return Nxixi(i, xi); });
+    }
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,101 @@
+#ifndef FINITE_ELEMENT_1D_HIERARCHICAL_HPP
+#define FINITE_ELEMENT_1D_HIERARCHICAL_HPP
+
+#include "element_1d.hpp"
+#include "basis/hierarchical.hpp"
+
+namespace metamath::finite_element {
+
+// Элементы, базис порядка p которых содержит базис порядка p - 1 в виде первых функций.
+// Для таких элементов element_1d_integrate и element_2d_integrate предоставляют метод set_order,
+// который достраивает таблицы при повышении порядка вместо их повторного построения.
+template<template<class> class Element_Type>
+inline constexpr bool is_hierarchical_v = false;
+
+template<>
+inline constexpr bool is_hierarchical_v<hierarchical> = true;
+
+// Иерархические элементы произвольного порядка. Порядок задаётся при создании элемента
+// и передаётся через конструктор element_1d_integrate: element_1d_integrate<T, hierarchical>{quadrature, order}.
+template<class T>
+class element_1d_hierarchical : public virtual element_1d_base<T>,
+                                public hierarchical<T> {
+public:
+    explicit element_1d_hierarchical(const size_t order)
+        : hierarchical<T>{order} {}
+
+    ~element_1d_hierarchical() override = default;
+
+    size_t nodes_count() const override { return hierarchical<T>::order() + 1; }
+
+    T node(const size_t i) const override { return hierarchical<T>::mode_node(i); }
+
+    T N(const size_t i, const T xi) const override {
+        std::vector<T> values(nodes_count());
+        hierarchical<T>::template evaluate<T>(hierarchical<T>::order(), xi, values.data(), nullptr, 1);
+        return values[i];
+    }
+
+    T Nxi(const size_t i, const T xi) const override {
+        std::vector<T> values(nodes_count());
+        hierarchical<T>::template evaluate<T>(hierarchical<T>::order(), xi, nullptr, values.data(), 1);
+        return values[i];
+    }
+
+    T Nxixi(const size_t i, const T xi) const override {
+        std::vector<T> values(nodes_count());
+        hierarchical<T>::template evaluate<T>(hierarchical<T>::order(), xi, nullptr, nullptr, 1, values.data());
+        return values[i];
+    }
+
+    T boundary(const side_1d bound) const override { return hierarchical<T>::boundary(bound); }
+
+    // Функции N_k, k >= 2, обращаются в ноль на концах отрезка.
+    std::vector<size_t> interior_nodes() const override {
+        std::vector<size_t> result;
+        for(size_t k = 2; k < nodes_count(); ++k)
+            result.push_back(k);
+        return result;
+    }
+
+    void tabulate(const std::vector<T>& points, const derivative_1d mask, T* out) const override {
+        T* const N     = mask & derivative_1d::N    ? std::exchange(out, out + nodes_count() * points.size()) : nullptr;
+        T* const Nxi   = mask & derivative_1d::XI   ? std::exchange(out, out + nodes_count() * points.size()) : nullptr;
+        T* const Nxixi = mask & derivative_1d::XIXI ? out : nullptr;
+        for(size_t k = 0; k < points.size(); ++k)
+            hierarchical<T>::template evaluate<T>(hierarchical<T>::order(), points[k], N ? N + k : nullptr, Nxi ? Nxi + k : nullptr,
+                                                  points.size(), Nxixi ? Nxixi + k : nullptr);
+    }
+
+    // Смена порядка элемента. Элементы с таблицами меняют порядок своими методами set_order, которые обновляют таблицы.
+    void set_order(const size_t order) { hierarchical<T>::set_order(order); }
+
+protected:
+    std::vector<T> parameters() const { return {T(hierarchical<T>::order())}; }
+
+    // Пакетное вычисление функций формы с номерами от first в типе Eval_T, результат сохраняется в типе T.
+    template<class Eval_T>
+    void tabulate_modes(const std::vector<std::array<T, 1>>& points, const size_t first, T* const N, T* const Nxi, T* const Nxixi = nullptr) const {
+        for(size_t k = 0; k < points.size(); ++k)
+            hierarchical<T>::template evaluate<Eval_T>(hierarchical<T>::order(), points[k][0], N ? N + k : nullptr, Nxi ? Nxi + k : nullptr,
+                                                       points.size(), Nxixi ? Nxixi + k : nullptr, first);
+    }
+
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 1>>& points, T* const N, T* const Nxi, T* const Nxixi = nullptr) const {
+        tabulate_modes<Eval_T>(points, 0, N, Nxi, Nxixi);
+    }
+};
+
+template<class T>
+class element_1d<T, hierarchical> : public element_1d_hierarchical<T> {
+public:
+    explicit element_1d(const size_t order)
+        : element_1d_hierarchical<T>{order} {}
+
+    ~element_1d() override = default;
+};
+
+}
+
+#endif
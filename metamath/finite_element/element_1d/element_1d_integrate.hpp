@@ -2,17 +2,36 @@
 #define FINITE_ELEMENT_1D_INTEGRATE_HPP
 
 #include "element_1d.hpp"
+#include "element_1d_lagrange.hpp"
+#include "element_1d_hierarchical.hpp"
 #include "element_1d_integrate_base.hpp"
 
 namespace metamath::finite_element {
 
-template<class T, template<class> class Element_Type>
+// Eval_T --- тип, в котором вычисляются функции формы при построении таблиц. Веса и таблицы хранятся в типе T.
+// Вычисление в типе меньшей точности (например, float при T = double) ускоряет только построение таблиц ценой контролируемой потери точности:
+// значения округляются до Eval_T и записываются в таблицы типа T, а все ядра, использующие таблицы, читают и накапливают их в типе T.
+template<class T, template<class> class Element_Type, class Eval_T = T>
 class element_1d_integrate : public element_1d_integrate_base<T>,
                              public element_1d<T, Element_Type> {
-    using element_1d_integrate_base<T>::_weights;
-    using element_1d_integrate_base<T>::_qN;
-    using element_1d_integrate_base<T>::_qNxi;
+    static_assert(std::is_floating_point_v<Eval_T>, "The Eval_T must be floating point.");
+
+protected:
     using element_1d_integrate_base<T>::_quadrature;
+    using element_1d_integrate_base<T>::set_tabulation;
+
+    // Квадратурные узлы и веса на элементе.
+    std::pair<std::vector<std::array<T, 1>>, std::vector<T>> quadrature_points(const quadrature_1d_base<T>& quadrature) const {
+        std::vector<std::array<T, 1>> xi(quadrature.nodes_count());
+        std::vector<T> weights(quadrature.nodes_count());
+        T jacobian = (           boundary(side_1d::RIGHT) -            boundary(side_1d::LEFT)) /
+                     (quadrature.boundary(side_1d::RIGHT) - quadrature.boundary(side_1d::LEFT));
+        for(size_t q = 0; q < quadrature.nodes_count(); ++q) {
+            xi[q][0] = boundary(side_1d::LEFT) + (quadrature.node(q)[0] - quadrature.boundary(side_1d::LEFT)) * jacobian;
+            weights[q] = quadrature.weight(q) * jacobian;
+        }
+        return {std::move(xi), std::move(weights)};
+    }
 
 public:
     using element_1d_integrate_base<T>::qnodes_count;
@@ -20,29 +39,76 @@ public:
     using element_1d<T, Element_Type>::boundary;
     using element_1d<T, Element_Type>::N;
     using element_1d<T, Element_Type>::Nxi;
+    using element_1d<T, Element_Type>::Nxixi;
+    using element_1d<T, Element_Type>::tabulate;
+
+    using element_1d_integrate_base<T>::layout;
+    using element_1d_integrate_base<T>::set_layout;
+    using element_1d_integrate_base<T>::second_derivatives;
+    using element_1d_integrate_base<T>::set_second_derivatives;
+
+    explicit element_1d_integrate(const quadrature_1d_base<T>& quadrature, const table_layout layout = table_layout::NODE_MAJOR) {
+        set_layout(layout);
+        set_quadrature(quadrature);
+    }
+
+    // Конструктор для элементов, параметры которых задаются во время выполнения программы, например порядок элемента.
+    // Аргументы args передаются конструктору element_1d<T, Element_Type>.
+    template<class... Args>
+    explicit element_1d_integrate(const quadrature_1d_base<T>& quadrature, Args&&... args)
+        : element_1d<T, Element_Type>{std::forward<Args>(args)...} {
+        set_quadrature(quadrature);
+    }
 
-    explicit element_1d_integrate(const quadrature_1d_base<T>& quadrature) { set_quadrature(quadrature); }
     ~element_1d_integrate() override = default;
 
+protected:
+    // Конструктор для наследников, которые заполняют таблицы самостоятельно.
+    explicit element_1d_integrate() = default;
+
+public:
+
+    // Квадратура и таблицы берутся из реестра, поэтому элементы одного типа с одной квадратурой разделяют общие данные.
     void set_quadrature(const quadrature_1d_base<T>& quadrature) override {
-        _quadrature = quadrature.clone();
-        std::vector<T> xi(quadrature.nodes_count());
-        _weights.resize(quadrature.nodes_count());
-        T jacobian = (           boundary(side_1d::RIGHT) -            boundary(side_1d::LEFT)) /
-                     (quadrature.boundary(side_1d::RIGHT) - quadrature.boundary(side_1d::LEFT));
-        for(size_t q = 0; q < quadrature.nodes_count(); ++q) {
-            xi[q] = boundary(side_1d::LEFT) + (quadrature.node(q)[0] - quadrature.boundary(side_1d::LEFT)) * jacobian;
-            _weights[q] = quadrature.weight(q) * jacobian;
-        }
+        _quadrature = shared_registry<std::type_index, quadrature_1d_base<T>>::instance().get(typeid(quadrature), [&quadrature] {
+            return std::shared_ptr<const quadrature_1d_base<T>>{quadrature.clone()};
+        });
+        set_tabulation(typeid(element_1d_integrate), {typeid(quadrature)}, element_1d<T, Element_Type>::parameters(), [this, &quadrature] {
+            const auto [xi, weights] = quadrature_points(quadrature);
+            const size_t nodes_count = element_1d<T, Element_Type>::nodes_count();
+            std::vector<T> qN(nodes_count * weights.size()), qNxi(nodes_count * weights.size()),
+                           qNxixi(second_derivatives() ? nodes_count * weights.size() : 0);
+            element_1d<T, Element_Type>::template tabulate_basis<Eval_T>(xi, qN.data(), qNxi.data(), second_derivatives() ? qNxixi.data() : nullptr);
+            std::vector<const T*> tables = {qN.data(), qNxi.data()};
+            if (second_derivatives())
+                tables.push_back(qNxixi.data());
+            return std::make_shared<const tabulation<T>>(layout(), weights, nodes_count, tables);
+        });
+    }
 
-        _qN  .resize(element_1d<T, Element_Type>::nodes_count() * qnodes_count());
-        _qNxi.resize(element_1d<T, Element_Type>::nodes_count() * qnodes_count());
-        for(size_t i = 0; i < nodes_count(); ++i) {
-            for(size_t q = 0; q < qnodes_count(); ++q) {
-                _qN  [i*qnodes_count() + q] = N  (i, xi[q]);
-                _qNxi[i*qnodes_count() + q] = Nxi(i, xi[q]);
-            }
-        }
+    // Смена порядка иерархического элемента. Таблицы функций, общих с предыдущим порядком, копируются из текущей табуляции,
+    // а вычисляются только таблицы добавленных функций; при понижении порядка функции не вычисляются вовсе.
+    template<bool Hierarchical = is_hierarchical_v<Element_Type>>
+    std::enable_if_t<Hierarchical> set_order(const size_t order) {
+        const std::shared_ptr<const tabulation<T>> previous = element_integrate_base<T>::shared_tabulation();
+        element_1d<T, Element_Type>::set_order(order);
+        set_tabulation(element_1d<T, Element_Type>::parameters(), [this, &previous] {
+            const auto [xi, weights] = quadrature_points(*_quadrature);
+            const size_t nodes_count = element_1d<T, Element_Type>::nodes_count(), components = previous->components_count(),
+                         kept = std::min(nodes_count, previous->nodes_count());
+            std::vector<std::vector<T>> tables(components, std::vector<T>(nodes_count * weights.size()));
+            for(size_t c = 0; c < components; ++c)
+                for(size_t i = 0; i < kept; ++i)
+                    for(size_t q = 0; q < weights.size(); ++q)
+                        tables[c][i * weights.size() + q] = (*previous)(c, i, q);
+            if (kept < nodes_count)
+                element_1d<T, Element_Type>::template tabulate_modes<Eval_T>(xi, kept, tables[0].data(), tables[1].data(),
+                                                                             components > 2 ? tables[2].data() : nullptr);
+            std::vector<const T*> data(components);
+            for(size_t c = 0; c < components; ++c)
+                data[c] = tables[c].data();
+            return std::make_shared<const tabulation<T>>(layout(), weights, nodes_count, data);
+        });
     }
 };
 
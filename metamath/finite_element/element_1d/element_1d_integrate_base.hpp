@@ -12,8 +12,7 @@ template<class T>
 class element_1d_integrate_base : public element_integrate_base<T>,
                                   private virtual element_1d_base<T> {
 protected:
-    std::vector<T> _qNxi;
-    std::unique_ptr<quadrature_1d_base<T>> _quadrature = nullptr;
+    std::shared_ptr<const quadrature_1d_base<T>> _quadrature = nullptr;
 
 public:
     using element_integrate_base<T>::nodes_count;
@@ -22,13 +21,28 @@ public:
     using element_1d_base<T>::node;
     using element_1d_base<T>::N;
     using element_1d_base<T>::Nxi;
+    using element_1d_base<T>::Nxixi;
 
     ~element_1d_integrate_base() override = default;
 
     virtual void set_quadrature(const quadrature_1d_base<T>& quadrature) = 0;
-    const std::unique_ptr<quadrature_1d_base<T>>& quadrature() const noexcept { return _quadrature; }
+    const std::shared_ptr<const quadrature_1d_base<T>>& quadrature() const noexcept { return _quadrature; }
 
-    T qNxi(const size_t i, const size_t q) const noexcept { return _qNxi[i*qnodes_count() + q]; }
+    T qNxi(const size_t i, const size_t q) const noexcept { return element_integrate_base<T>::table(1, i, q); }
+
+    strided_span<const T> qNxi_row   (const size_t i) const noexcept { return element_integrate_base<T>::table_row   (1, i); }
+    strided_span<const T> qNxi_column(const size_t q) const noexcept { return element_integrate_base<T>::table_column(1, q); }
+
+    // Таблицы вторых производных доступны, если они были запрошены методом set_second_derivatives до построения таблиц.
+    T qNxixi(const size_t i, const size_t q) const noexcept { return element_integrate_base<T>::table(2, i, q); }
+
+    strided_span<const T> qNxixi_row   (const size_t i) const noexcept { return element_integrate_base<T>::table_row   (2, i); }
+    strided_span<const T> qNxixi_column(const size_t q) const noexcept { return element_integrate_base<T>::table_column(2, q); }
+
+    // Матрицы эталонного элемента: масса, жёсткость и конвекция, вычисленные по текущим таблицам.
+    std::shared_ptr<const reference_matrices<T>> shared_reference_matrices() const {
+        return element_integrate_base<T>::shared_reference_matrices(1);
+    }
 };
 
 }
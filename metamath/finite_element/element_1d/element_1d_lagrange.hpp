@@ -0,0 +1,77 @@
+#ifndef FINITE_ELEMENT_1D_LAGRANGE_HPP
+#define FINITE_ELEMENT_1D_LAGRANGE_HPP
+
+#include "element_1d.hpp"
+#include "basis/lagrange.hpp"
+
+namespace metamath::finite_element {
+
+// Лагранжевы элементы произвольного порядка. Порядок и распределение узлов задаются при создании элемента
+// и передаются через конструктор element_1d_integrate: element_1d_integrate<T, lagrange>{quadrature, order, distribution}.
+template<class T>
+class element_1d_lagrange : public virtual element_1d_base<T>,
+                            public lagrange<T> {
+    using lagrange<T>::_nodes;
+
+public:
+    explicit element_1d_lagrange(const size_t order, const lagrange_nodes distribution = lagrange_nodes::GAUSS_LOBATTO)
+        : lagrange<T>{order, distribution} {}
+
+    ~element_1d_lagrange() override = default;
+
+    size_t nodes_count() const override { return _nodes.size(); }
+
+    T node(const size_t i) const override { return _nodes[i]; }
+
+    T N(const size_t i, const T xi) const override {
+        std::vector<T> values(nodes_count());
+        lagrange<T>::template evaluate<T>(xi, values.data(), nullptr, 1);
+        return values[i];
+    }
+
+    T Nxi(const size_t i, const T xi) const override {
+        std::vector<T> values(nodes_count());
+        lagrange<T>::template evaluate<T>(xi, nullptr, values.data(), 1);
+        return values[i];
+    }
+
+    T Nxixi(const size_t i, const T xi) const override {
+        std::vector<T> values(nodes_count());
+        lagrange<T>::template evaluate<T>(xi, nullptr, nullptr, 1, values.data());
+        return values[i];
+    }
+
+    T boundary(const side_1d bound) const override { return lagrange<T>::boundary(bound); }
+
+    void tabulate(const std::vector<T>& points, const derivative_1d mask, T* out) const override {
+        T* const N     = mask & derivative_1d::N    ? std::exchange(out, out + nodes_count() * points.size()) : nullptr;
+        T* const Nxi   = mask & derivative_1d::XI   ? std::exchange(out, out + nodes_count() * points.size()) : nullptr;
+        T* const Nxixi = mask & derivative_1d::XIXI ? out : nullptr;
+        for(size_t k = 0; k < points.size(); ++k)
+            lagrange<T>::template evaluate<T>(points[k], N ? N + k : nullptr, Nxi ? Nxi + k : nullptr, points.size(), Nxixi ? Nxixi + k : nullptr);
+    }
+
+protected:
+    std::vector<T> parameters() const { return {T(lagrange<T>::order()), T(lagrange<T>::distribution())}; }
+
+    // Пакетное вычисление функций формы в типе Eval_T, результат сохраняется в типе T.
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 1>>& points, T* const N, T* const Nxi, T* const Nxixi = nullptr) const {
+        for(size_t k = 0; k < points.size(); ++k)
+            lagrange<T>::template evaluate<Eval_T>(points[k][0], N ? N + k : nullptr, Nxi ? Nxi + k : nullptr, points.size(),
+                                                   Nxixi ? Nxixi + k : nullptr);
+    }
+};
+
+template<class T>
+class element_1d<T, lagrange> : public element_1d_lagrange<T> {
+public:
+    explicit element_1d(const size_t order, const lagrange_nodes distribution = lagrange_nodes::GAUSS_LOBATTO)
+        : element_1d_lagrange<T>{order, distribution} {}
+
+    ~element_1d() override = default;
+};
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef FINITE_ELEMENT_STATIC_ELEMENT_1D_INTEGRATE_HPP
+#define FINITE_ELEMENT_STATIC_ELEMENT_1D_INTEGRATE_HPP
+
+#include "element_1d_integrate.hpp"
+
+namespace metamath::finite_element {
+
+// Элемент, у которого количество узлов и квадратурных точек известно на этапе компиляции.
+// Интерфейс не содержит виртуальных функций, а таблицы хранятся в std::array, поэтому циклы сборки
+// по узлам и квадратурным точкам могут быть полностью развёрнуты и векторизованы компилятором.
+template<class T, template<class> class Element_Type, template<class> class Quadrature_Type>
+class static_element_1d_integrate {
+    struct element_data : Element_Type<T> {
+        using Element_Type<T>::nodes;
+    };
+
+    struct quadrature_data : Quadrature_Type<T> {
+        using Quadrature_Type<T>::weights;
+    };
+
+public:
+    static constexpr size_t  nodes_count() noexcept { return std::tuple_size_v<std::decay_t<decltype(element_data::nodes)>>; }
+    static constexpr size_t qnodes_count() noexcept { return std::tuple_size_v<std::decay_t<decltype(quadrature_data::weights)>>; }
+
+private:
+    std::array<T, qnodes_count()> _weights;
+    std::array<T, nodes_count() * qnodes_count()> _qN, _qNxi;
+
+public:
+    // Таблицы строятся один раз при создании объекта при помощи динамического элемента.
+    explicit static_element_1d_integrate() {
+        const element_1d_integrate<T, Element_Type> element{quadrature_1d<T, Quadrature_Type>{}};
+        for(size_t q = 0; q < qnodes_count(); ++q)
+            _weights[q] = element.weight(q);
+        for(size_t i = 0; i < nodes_count(); ++i)
+            for(size_t q = 0; q < qnodes_count(); ++q) {
+                _qN  [i*qnodes_count() + q] = element.qN  (i, q);
+                _qNxi[i*qnodes_count() + q] = element.qNxi(i, q);
+            }
+    }
+
+    static constexpr T node(const size_t i) noexcept { return element_data::nodes[i]; }
+
+    T weight(const size_t q) const noexcept { return _weights[q]; }
+
+    T qN  (const size_t i, const size_t q) const noexcept { return _qN  [i*qnodes_count() + q]; }
+    T qNxi(const size_t i, const size_t q) const noexcept { return _qNxi[i*qnodes_count() + q]; }
+
+    // Доступ к таблицам целиком.
+    const std::array<T, qnodes_count()>& weights() const noexcept { return _weights; }
+    const std::array<T, nodes_count() * qnodes_count()>& qN  () const noexcept { return _qN;   }
+    const std::array<T, nodes_count() * qnodes_count()>& qNxi() const noexcept { return _qNxi; }
+};
+
+// Адаптер статического элемента к интерфейсу element_1d_integrate_base для кода, которому нужен виртуальный интерфейс.
+// Таблицы копируются из статического элемента без повторного вычисления функций формы.
+template<class T, template<class> class Element_Type, template<class> class Quadrature_Type>
+class static_element_1d_adapter : public element_1d_integrate<T, Element_Type> {
+    using element_1d_integrate<T, Element_Type>::_quadrature;
+    using element_1d_integrate<T, Element_Type>::set_tabulation;
+
+public:
+    // Табуляция совпадает с табуляцией element_1d_integrate с той же квадратурой, поэтому разделяется с ней через реестр.
+    explicit static_element_1d_adapter(const static_element_1d_integrate<T, Element_Type, Quadrature_Type>& element,
+                                       const table_layout layout = table_layout::NODE_MAJOR) {
+        this->set_layout(layout);
+        _quadrature = shared_registry<std::type_index, quadrature_1d_base<T>>::instance().get(typeid(quadrature_1d<T, Quadrature_Type>), [] {
+            return std::make_shared<const quadrature_1d<T, Quadrature_Type>>();
+        });
+        set_tabulation(typeid(element_1d_integrate<T, Element_Type>), {typeid(quadrature_1d<T, Quadrature_Type>)},
+                       element_1d<T, Element_Type>::parameters(), [&element, layout] {
+            const std::vector<T> weights(element.weights().cbegin(), element.weights().cend());
+            return std::make_shared<const tabulation<T>>(layout, weights, element.nodes_count(),
+                                                         std::vector<const T*>{element.qN().data(), element.qNxi().data()});
+        });
+    }
+
+    ~static_element_1d_adapter() override = default;
+};
+
+}
+
+#endif
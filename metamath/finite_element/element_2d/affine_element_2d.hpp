@@ -0,0 +1,143 @@
+#ifndef FINITE_ELEMENT_AFFINE_ELEMENT_2D_HPP
+#define FINITE_ELEMENT_AFFINE_ELEMENT_2D_HPP
+
+#include <cmath>
+#include <array>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include "element_2d.hpp"
+#include "reference_matrices.hpp"
+#include "element_2d_hierarchical.hpp"
+#include "element_2d_dubiner.hpp"
+#include "basis/triangle.hpp"
+
+namespace metamath::finite_element {
+
+// Элементы, изопараметрическое отображение которых аффинно при любом положении узлов, а производные функций формы постоянны.
+// Для таких элементов матрица Якоби и физические градиенты функций формы вычисляются один раз на элемент,
+// и цикл по квадратурным узлам в ядрах сборки сводится к одной взвешенной сумме.
+template<template<class> class Element_Type>
+inline constexpr bool is_affine_v = false;
+
+template<>
+inline constexpr bool is_affine_v<triangle> = true;
+
+// Аффинное отображение x = origin + J xi эталонного элемента на физический с матрицей Якоби J = dx/dxi.
+template<class T>
+class affine_map_2d final {
+    std::array<T, 2> _origin = {};
+    std::array<std::array<T, 2>, 2> _jacobian = {}, _inverse = {};
+    T _determinant = T{0};
+
+public:
+    explicit affine_map_2d(const std::array<T, 2>& origin, const std::array<std::array<T, 2>, 2>& jacobian)
+        : _origin{origin}
+        , _jacobian{jacobian}
+        , _determinant{jacobian_determinant(jacobian)} {
+        if (_determinant == T{0})
+            throw std::domain_error{"The affine map is degenerate."};
+        _inverse = {{{ jacobian[1][1] / _determinant, -jacobian[0][1] / _determinant},
+                     {-jacobian[1][0] / _determinant,  jacobian[0][0] / _determinant}}};
+    }
+
+    const std::array<T, 2>& origin() const noexcept { return _origin; }
+    const std::array<std::array<T, 2>, 2>& jacobian() const noexcept { return _jacobian; }
+    const std::array<std::array<T, 2>, 2>& inverse() const noexcept { return _inverse; }
+    T determinant() const noexcept { return _determinant; }
+
+    std::array<T, 2> operator()(const std::array<T, 2>& xi) const noexcept {
+        return {_origin[0] + _jacobian[0][0] * xi[0] + _jacobian[0][1] * xi[1],
+                _origin[1] + _jacobian[1][0] * xi[0] + _jacobian[1][1] * xi[1]};
+    }
+
+    // Физический градиент J^{-T} (dN/dxi, dN/deta).
+    std::array<T, 2> gradient(const std::array<T, 2>& reference) const noexcept {
+        return {_inverse[0][0] * reference[0] + _inverse[1][0] * reference[1],
+                _inverse[0][1] * reference[0] + _inverse[1][1] * reference[1]};
+    }
+};
+
+// Образ точки xi при изопараметрическом отображении x(xi) = sum_k x_k N_k(xi).
+template<class T>
+std::array<T, 2> mapping_point(const element_2d_base<T>& element, const std::vector<std::array<T, 2>>& coordinates, const std::array<T, 2>& xi) {
+    std::array<T, 2> point = {};
+    for(size_t k = 0; k < element.nodes_count(); ++k) {
+        const T N = element.N(k, xi);
+        for(size_t a = 0; a < 2; ++a)
+            point[a] += coordinates[k][a] * N;
+    }
+    return point;
+}
+
+// Матрица Якоби изопараметрического отображения x(xi) = sum_k x_k N_k(xi) в точке xi.
+template<class T>
+std::array<std::array<T, 2>, 2> mapping_jacobian(const element_2d_base<T>& element, const std::vector<std::array<T, 2>>& coordinates,
+                                                 const std::array<T, 2>& xi) {
+    std::array<std::array<T, 2>, 2> jacobian = {};
+    for(size_t k = 0; k < element.nodes_count(); ++k) {
+        const T Nxi = element.Nxi(k, xi), Neta = element.Neta(k, xi);
+        for(size_t a = 0; a < 2; ++a) {
+            jacobian[a][0] += coordinates[k][a] * Nxi;
+            jacobian[a][1] += coordinates[k][a] * Neta;
+        }
+    }
+    return jacobian;
+}
+
+// Аффинное отображение элемента с координатами узлов coordinates или std::nullopt, если отображение не аффинно.
+// Компоненты матрицы Якоби принадлежат пространству функций формы элемента, поэтому отображение аффинно тогда и только тогда,
+// когда матрицы Якоби во всех узлах элемента совпадают с точностью tolerance относительно их нормы.
+// Так, например, билинейный элемент аффинен, если он является параллелограммом.
+// Узлы узлового элемента различны и однозначно определяют функцию из пространства элемента, поэтому проверки в них достаточно.
+// Для модальных и иерархических элементов коэффициенты не являются координатами узлов, а их условные узлы могут совпадать,
+// поэтому такие элементы отвергаются.
+template<class T>
+std::optional<affine_map_2d<T>> affine_mapping(const element_2d_base<T>& element, const std::vector<std::array<T, 2>>& coordinates,
+                                               const T tolerance = std::sqrt(std::numeric_limits<T>::epsilon())) {
+    if (!element.nodal())
+        throw std::domain_error{"The affine mapping requires a nodal element."};
+    if (coordinates.size() != element.nodes_count())
+        throw std::domain_error{"The coordinates size does not match the nodes count."};
+    const std::array<std::array<T, 2>, 2> jacobian = mapping_jacobian(element, coordinates, element.node(0));
+    const T norm = std::max(std::max(std::abs(jacobian[0][0]), std::abs(jacobian[0][1])),
+                            std::max(std::abs(jacobian[1][0]), std::abs(jacobian[1][1])));
+    for(size_t i = 1; i < element.nodes_count(); ++i) {
+        const std::array<std::array<T, 2>, 2> current = mapping_jacobian(element, coordinates, element.node(i));
+        for(size_t a = 0; a < 2; ++a)
+            for(size_t b = 0; b < 2; ++b)
+                if (std::abs(current[a][b] - jacobian[a][b]) > tolerance * norm)
+                    return std::nullopt;
+    }
+    return affine_map_2d<T>{mapping_point(element, coordinates, {T{0}, T{0}}), jacobian};
+}
+
+// Для элементов с is_affine_v проверка не требуется: матрица Якоби вычисляется в одной точке.
+template<class T, template<class> class Element_Type>
+std::optional<affine_map_2d<T>> affine_mapping(const element_2d<T, Element_Type>& element, const std::vector<std::array<T, 2>>& coordinates,
+                                               const T tolerance = std::sqrt(std::numeric_limits<T>::epsilon())) {
+    static_assert(!is_hierarchical_v<Element_Type>, "The coefficients of hierarchical and modal elements are not nodal coordinates.");
+    if constexpr (is_affine_v<Element_Type>) {
+        if (coordinates.size() != element.nodes_count())
+            throw std::domain_error{"The coordinates size does not match the nodes count."};
+        return affine_map_2d<T>{mapping_point<T>(element, coordinates, {T{0}, T{0}}), mapping_jacobian<T>(element, coordinates, element.node(0))};
+    } else
+        return affine_mapping(static_cast<const element_2d_base<T>&>(element), coordinates, tolerance);
+}
+
+// Физические градиенты функций формы элемента с is_affine_v, одни на весь элемент.
+// Например, матрица жёсткости такого элемента равна K_ij = |det J| S (g_i, g_j), где S --- площадь эталонного элемента, то есть сумма квадратурных весов.
+template<class T, template<class> class Element_Type>
+std::vector<std::array<T, 2>> constant_gradients(const element_2d<T, Element_Type>& element, const affine_map_2d<T>& map) {
+    static_assert(is_affine_v<Element_Type>, "The gradients of the Element_Type are not constant.");
+    std::vector<std::array<T, 2>> gradients(element.nodes_count());
+    for(size_t i = 0; i < element.nodes_count(); ++i)
+        gradients[i] = map.gradient({element.Nxi(i, element.node(0)), element.Neta(i, element.node(0))});
+    return gradients;
+}
+
+}
+
+#endif
@@ -10,5 +10,11 @@
 #include "qubic_serendipity.hpp"
 #include "quartic_serendipity.hpp"
 #include "quintic_serendipity.hpp"
+#include "nodal_qubic_triangle.hpp"
+#include "nodal_qubic_serendipity.hpp"
+#include "nodal_quartic_serendipity.hpp"
+#include "nodal_quintic_serendipity.hpp"
+#include "hierarchical_quadrilateral.hpp"
+#include "dubiner_triangle.hpp"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,117 @@
+#ifndef FINITE_ELEMENT_2D_BASIS_DUBINER_TRIANGLE_HPP
+#define FINITE_ELEMENT_2D_BASIS_DUBINER_TRIANGLE_HPP
+
+#include <cmath>
+#include <vector>
+#include "geometry_2d.hpp"
+#include "jacobi.hpp"
+
+namespace metamath::finite_element {
+
+// Ортогональный базис Дубинера порядка n на треугольнике (0,0), (1,0), (0,1) в сжатых координатах
+// a = 2 eta / (1 - xi) - 1, b = 2 xi - 1, которые отображают квадрат [-1, 1]^2 на треугольник со стягиванием стороны в вершину (1,0):
+// psi_pq = c_pq P_p(a) (1 - xi)^p P_q^{(2p+1,0)}(b), p + q <= n, c_pq = sqrt((2p + 1) (2p + 2q + 2)).
+// Стягиваемое направление совпадает с тем, в котором element_2d_integrate отображает квадратуру квадрата на треугольник,
+// поэтому в квадратурных узлах a зависит только от узла по eta, а b --- только от узла по xi.
+// Функции ортонормированы на эталонном треугольнике, поэтому при точной квадратуре матрица массы единичная.
+// Функции упорядочены по степени d = p + q, поэтому базис порядка n - 1 совпадает с первыми функциями базиса порядка n.
+// Базис модальный: функции не связаны с узлами, и все они условно относятся к центру треугольника.
+template<class T>
+class dubiner_triangle : public geometry_2d<T, triangle_element_geometry> {
+public:
+    size_t order() const noexcept { return _order; }
+
+    // Номера {p, q} многочленов Лежандра и Якоби для каждой функции элемента.
+    const std::vector<std::array<size_t, 2>>& modes() const noexcept { return _modes; }
+
+protected:
+    size_t _order = 0;
+    std::vector<std::array<size_t, 2>> _modes;
+    std::vector<std::array<T, 2>> _nodes;
+
+    explicit dubiner_triangle(const size_t order) { set_order(order); }
+
+    ~dubiner_triangle() override = default;
+
+    void set_order(const size_t order) {
+        _order = order;
+        _modes.clear();
+        for(size_t d = 0; d <= order; ++d)
+            for(size_t p = 0; p <= d; ++p)
+                _modes.push_back({p, d - p});
+        _nodes.assign(_modes.size(), {T{1} / T{3}, T{1} / T{3}});
+    }
+
+    // Множители c_pq P_q^{(2p+1,0)}(2 xi - 1) и их первые и вторые производные по xi для всех функций элемента:
+    // factors[3*k], factors[3*k + 1], factors[3*k + 2]. Они зависят только от xi, поэтому при табуляции
+    // вычисляются один раз для всех точек с общей координатой xi.
+    template<class Eval_T>
+    void jacobi_factors(const T xi, Eval_T* const factors) const {
+        const Eval_T b = Eval_T{2} * static_cast<Eval_T>(xi) - Eval_T{1};
+        std::vector<std::vector<Eval_T>> J(_order + 1); // Для каждого p: значения, первые и вторые производные P_q^{(2p+1,0)}.
+        for(size_t p = 0; p <= _order; ++p) {
+            const size_t n = _order - p;
+            J[p].resize(3 * (n + 1));
+            function::jacobi_values(n, Eval_T(2*p + 1), Eval_T{0}, b, J[p].data(), J[p].data() + n + 1, J[p].data() + 2 * (n + 1));
+        }
+        for(size_t k = 0; k < _modes.size(); ++k) {
+            const auto [p, q] = _modes[k];
+            const size_t n = _order - p;
+            const Eval_T c = std::sqrt(Eval_T(2*p + 1) * Eval_T(2*p + 2*q + 2));
+            factors[3*k]     = c * J[p][q];
+            factors[3*k + 1] = c * Eval_T{2} * J[p][n + 1 + q];
+            factors[3*k + 2] = c * Eval_T{4} * J[p][2 * (n + 1) + q];
+        }
+    }
+
+    // Значения функций с номерами от first и их производных в точке xi по множителям jacobi_factors: N[k*stride] и т.д.
+    // Многочлены L_p = (1 - xi)^p P_p(a) вычисляются вместе с производными по рекуррентному соотношению
+    // (k + 1) L_{k+1} = (2k + 1) (2 eta - 1 + xi) L_k - k (1 - xi)^2 L_{k-1}, которое не имеет особенности в вершине (1,0).
+    // Вычисление одной точки стоит O(n^2) действий. Нулевые указатели пропускаются.
+    template<class Eval_T>
+    void evaluate(const std::array<T, 2>& xi, const Eval_T* const factors, T* const N, T* const Nxi, T* const Neta, const size_t stride,
+                  T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr, const size_t first = 0) const {
+        using jet = std::array<Eval_T, 6>; // Значение и производные по xi, eta, xi xi, xi eta, eta eta.
+        const auto multiply = [](const jet& f, const jet& g) -> jet {
+            return {f[0] * g[0],
+                    f[1] * g[0] + f[0] * g[1],
+                    f[2] * g[0] + f[0] * g[2],
+                    f[3] * g[0] + Eval_T{2} * f[1] * g[1] + f[0] * g[3],
+                    f[4] * g[0] + f[1] * g[2] + f[2] * g[1] + f[0] * g[4],
+                    f[5] * g[0] + Eval_T{2} * f[2] * g[2] + f[0] * g[5]};
+        };
+        const Eval_T x = static_cast<Eval_T>(xi[0]), y = static_cast<Eval_T>(xi[1]), t = Eval_T{1} - x;
+        const jet shifted = {Eval_T{2} * y - Eval_T{1} + x, Eval_T{1}, Eval_T{2}, Eval_T{0}, Eval_T{0}, Eval_T{0}},
+                  squared = {t * t, -Eval_T{2} * t, Eval_T{0}, Eval_T{2}, Eval_T{0}, Eval_T{0}};
+        std::vector<jet> L(_order + 1);
+        L[0] = {Eval_T{1}};
+        if (_order > 0)
+            L[1] = shifted;
+        for(size_t k = 1; k < _order; ++k) {
+            const jet left = multiply(shifted, L[k]), right = multiply(squared, L[k-1]);
+            for(size_t d = 0; d < 6; ++d)
+                L[k+1][d] = (Eval_T(2*k + 1) * left[d] - Eval_T(k) * right[d]) / Eval_T(k + 1);
+        }
+        for(size_t k = first; k < _modes.size(); ++k) {
+            const jet psi = multiply(L[_modes[k][0]], {factors[3*k], factors[3*k + 1], Eval_T{0}, factors[3*k + 2], Eval_T{0}, Eval_T{0}});
+            if (N)       N      [k*stride] = static_cast<T>(psi[0]);
+            if (Nxi)     Nxi    [k*stride] = static_cast<T>(psi[1]);
+            if (Neta)    Neta   [k*stride] = static_cast<T>(psi[2]);
+            if (Nxixi)   Nxixi  [k*stride] = static_cast<T>(psi[3]);
+            if (Nxieta)  Nxieta [k*stride] = static_cast<T>(psi[4]);
+            if (Netaeta) Netaeta[k*stride] = static_cast<T>(psi[5]);
+        }
+    }
+
+    template<class Eval_T>
+    void evaluate(const std::array<T, 2>& xi, T* const N, T* const Nxi, T* const Neta, const size_t stride,
+                  T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr, const size_t first = 0) const {
+        std::vector<Eval_T> factors(3 * _modes.size());
+        jacobi_factors<Eval_T>(xi[0], factors.data());
+        evaluate<Eval_T>(xi, factors.data(), N, Nxi, Neta, stride, Nxixi, Nxieta, Netaeta, first);
+    }
+};
+
+}
+
+#endif
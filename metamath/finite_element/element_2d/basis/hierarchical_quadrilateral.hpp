@@ -0,0 +1,70 @@
+#ifndef FINITE_ELEMENT_2D_BASIS_HIERARCHICAL_QUADRILATERAL_HPP
+#define FINITE_ELEMENT_2D_BASIS_HIERARCHICAL_QUADRILATERAL_HPP
+
+#include "geometry_2d.hpp"
+#include "basis/hierarchical.hpp"
+
+namespace metamath::finite_element {
+
+// Иерархический четырёхугольный элемент порядка p: произведения N_i(xi) N_j(eta) одномерных иерархических функций, max(i, j) <= p.
+// Функции упорядочены по уровням m = max(i, j), поэтому базис порядка p - 1 совпадает с первыми функциями базиса порядка p:
+// вершинные функции (0,0), (1,0), (1,1), (0,1) нумеруются так же, как узлы bilinear, затем на каждом уровне m >= 2
+// следуют функции сторон DOWN (m,0), RIGHT (1,m), UP (m,1), LEFT (0,m) и внутренние функции (m,j), j = 2..m-1, и (i,m), i = 2..m.
+template<class T>
+class hierarchical_quadrilateral : public geometry_2d<T, rectangle_element_geometry> {
+public:
+    size_t order() const noexcept { return _order; }
+
+    // Номера одномерных функций {i, j} для каждой функции элемента.
+    const std::vector<std::array<size_t, 2>>& modes() const noexcept { return _modes; }
+
+protected:
+    size_t _order = 0;
+    std::vector<std::array<size_t, 2>> _modes;
+    std::vector<std::array<T, 2>> _nodes; // Условные координаты функций: вершины, середины сторон и центр.
+
+    explicit hierarchical_quadrilateral(const size_t order) { set_order(order); }
+
+    ~hierarchical_quadrilateral() override = default;
+
+    void set_order(const size_t order) {
+        if (order == 0)
+            throw std::domain_error{"The order of hierarchical element must be positive."};
+        _order = order;
+        _modes = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+        for(size_t m = 2; m <= order; ++m) {
+            _modes.insert(_modes.end(), {{m, 0}, {1, m}, {m, 1}, {0, m}});
+            for(size_t j = 2; j < m; ++j)
+                _modes.push_back({m, j});
+            for(size_t i = 2; i <= m; ++i)
+                _modes.push_back({i, m});
+        }
+        _nodes.resize(_modes.size());
+        for(size_t k = 0; k < _modes.size(); ++k)
+            _nodes[k] = {hierarchical<T>::mode_node(_modes[k][0]), hierarchical<T>::mode_node(_modes[k][1])};
+    }
+
+    // Значения функций с номерами от first и их производных в точке xi, вычисленные в типе Eval_T: N[k*stride] и т.д.
+    // Нулевые указатели пропускаются.
+    template<class Eval_T>
+    void evaluate(const std::array<T, 2>& xi, T* const N, T* const Nxi, T* const Neta, const size_t stride,
+                  T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr, const size_t first = 0) const {
+        const size_t n = _order + 1;
+        std::vector<T> X(3 * n), Y(3 * n); // Значения, первые и вторые производные одномерных функций.
+        hierarchical<T>::template evaluate<Eval_T>(_order, xi[0], X.data(), X.data() + n, 1, X.data() + 2 * n);
+        hierarchical<T>::template evaluate<Eval_T>(_order, xi[1], Y.data(), Y.data() + n, 1, Y.data() + 2 * n);
+        for(size_t k = first; k < _modes.size(); ++k) {
+            const auto [i, j] = _modes[k];
+            if (N)       N      [k*stride] = X[i]       * Y[j];
+            if (Nxi)     Nxi    [k*stride] = X[n + i]   * Y[j];
+            if (Neta)    Neta   [k*stride] = X[i]       * Y[n + j];
+            if (Nxixi)   Nxixi  [k*stride] = X[2*n + i] * Y[j];
+            if (Nxieta)  Nxieta [k*stride] = X[n + i]   * Y[n + j];
+            if (Netaeta) Netaeta[k*stride] = X[i]       * Y[2*n + j];
+        }
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef FINITE_ELEMENT_2D_BASIS_NODAL_QUARTIC_SERENDIPITY_HPP
+#define FINITE_ELEMENT_2D_BASIS_NODAL_QUARTIC_SERENDIPITY_HPP
+
+#include "geometry_2d.hpp"
+
+namespace metamath::finite_element {
+
+// Классический серендипов элемент четвёртого порядка, базис которого строится во время выполнения программы.
+// Пространство функций формы: полиномы четвёртой степени и одночлены xi^4 eta, xi eta^4.
+// Размерность пространства равна 17, поэтому к 16 граничным узлам добавляется узел в центре элемента.
+// Это классическое пространство S4, а не замена параметризованного элемента quartic_serendipity с 16 узлами и параметром p.
+template<class T>
+class nodal_quartic_serendipity : public geometry_2d<T, rectangle_element_geometry> {
+protected:
+    explicit nodal_quartic_serendipity() = default;
+    ~nodal_quartic_serendipity() override = default;
+
+    // Нумерация узлов: 12--11--10--9---8
+    //                  |               |
+    //                  13              7
+    //                  |               |
+    //                  14      16      6
+    //                  |               |
+    //                  15              5
+    //                  |               |
+    //                  0---1---2---3---4
+    static constexpr std::array<std::array<T, 2>, 17> nodes = { T{-1.0}, T{-1.0},
+                                                                T{-0.5}, T{-1.0},
+                                                                T{ 0.0}, T{-1.0},
+                                                                T{ 0.5}, T{-1.0},
+                                                                T{ 1.0}, T{-1.0},
+                                                                T{ 1.0}, T{-0.5},
+                                                                T{ 1.0}, T{ 0.0},
+                                                                T{ 1.0}, T{ 0.5},
+                                                                T{ 1.0}, T{ 1.0},
+                                                                T{ 0.5}, T{ 1.0},
+                                                                T{ 0.0}, T{ 1.0},
+                                                                T{-0.5}, T{ 1.0},
+                                                                T{-1.0}, T{ 1.0},
+                                                                T{-1.0}, T{ 0.5},
+                                                                T{-1.0}, T{ 0.0},
+                                                                T{-1.0}, T{-0.5},
+                                                                T{ 0.0}, T{ 0.0} };
+
+    static constexpr std::array<std::array<uint8_t, 2>, 17> monomials = { 0, 0,
+                                                                          1, 0, 0, 1,
+                                                                          2, 0, 1, 1, 0, 2,
+                                                                          3, 0, 2, 1, 1, 2, 0, 3,
+                                                                          4, 0, 3, 1, 2, 2, 1, 3, 0, 4,
+                                                                          4, 1, 1, 4 };
+};
+
+}
+
+#endif
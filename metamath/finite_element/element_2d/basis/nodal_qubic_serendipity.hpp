@@ -0,0 +1,47 @@
+#ifndef FINITE_ELEMENT_2D_BASIS_NODAL_QUBIC_SERENDIPITY_HPP
+#define FINITE_ELEMENT_2D_BASIS_NODAL_QUBIC_SERENDIPITY_HPP
+
+#include "geometry_2d.hpp"
+
+namespace metamath::finite_element {
+
+// Классический кубический серендипов элемент, базис которого строится во время выполнения программы.
+// Пространство функций формы: полиномы третьей степени и одночлены xi^3 eta, xi eta^3.
+// Это классическое пространство S3, а не замена параметризованного элемента qubic_serendipity: узлы совпадают,
+// но параметра p, управляющего функциями формы, у этого элемента нет.
+template<class T>
+class nodal_qubic_serendipity : public geometry_2d<T, rectangle_element_geometry> {
+protected:
+    explicit nodal_qubic_serendipity() = default;
+    ~nodal_qubic_serendipity() override = default;
+
+    // Нумерация узлов совпадает с qubic_serendipity: 9---8---7---6
+    //                                               |           |
+    //                                               10          5
+    //                                               |           |
+    //                                               11          4
+    //                                               |           |
+    //                                               0---1---2---3
+    static constexpr std::array<std::array<T, 2>, 12> nodes = {    -1.,    -1.,
+                                                                -1./3.,    -1.,
+                                                                 1./3.,    -1.,
+                                                                    1.,    -1.,
+                                                                    1., -1./3.,
+                                                                    1.,  1./3.,
+                                                                    1.,     1.,
+                                                                 1./3.,     1.,
+                                                                -1./3.,     1.,
+                                                                   -1.,     1.,
+                                                                   -1.,  1./3.,
+                                                                   -1., -1./3. };
+
+    static constexpr std::array<std::array<uint8_t, 2>, 12> monomials = { 0, 0,
+                                                                          1, 0, 0, 1,
+                                                                          2, 0, 1, 1, 0, 2,
+                                                                          3, 0, 2, 1, 1, 2, 0, 3,
+                                                                          3, 1, 1, 3 };
+};
+
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef FINITE_ELEMENT_2D_BASIS_NODAL_QUBIC_TRIANGLE_HPP
+#define FINITE_ELEMENT_2D_BASIS_NODAL_QUBIC_TRIANGLE_HPP
+
+#include "geometry_2d.hpp"
+
+namespace metamath::finite_element {
+
+// Кубический треугольный элемент, базис которого строится во время выполнения программы.
+// Пространство функций формы --- полиномы третьей степени, поэтому базис совпадает с qubic_triangle.
+template<class T>
+class nodal_qubic_triangle : public geometry_2d<T, triangle_element_geometry> {
+protected:
+    explicit nodal_qubic_triangle() = default;
+    ~nodal_qubic_triangle() override = default;
+
+    /*
+        Нумерация узлов совпадает с qubic_triangle: 1\
+                                                    5 4
+                                                    |  \
+                                                    6 9 3
+                                                    |    \
+                                                    2-7-8-0
+    */
+    static constexpr std::array<std::array<T, 2>, 10> nodes = {    1.,    0.,
+                                                                   0.,    1.,
+                                                                   0.,    0.,
+                                                                2./3., 1./3.,
+                                                                1./3., 2./3.,
+                                                                   0., 2./3.,
+                                                                   0., 1./3.,
+                                                                1./3.,    0.,
+                                                                2./3.,    0.,
+                                                                1./3., 1./3. };
+
+    // Одночлены xi^a eta^b, a + b <= 3.
+    static constexpr std::array<std::array<uint8_t, 2>, 10> monomials = { 0, 0,
+                                                                          1, 0, 0, 1,
+                                                                          2, 0, 1, 1, 0, 2,
+                                                                          3, 0, 2, 1, 1, 2, 0, 3 };
+};
+
+}
+
+#endif
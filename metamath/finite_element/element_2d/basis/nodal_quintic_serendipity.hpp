@@ -0,0 +1,64 @@
+#ifndef FINITE_ELEMENT_2D_BASIS_NODAL_QUINTIC_SERENDIPITY_HPP
+#define FINITE_ELEMENT_2D_BASIS_NODAL_QUINTIC_SERENDIPITY_HPP
+
+#include "geometry_2d.hpp"
+
+namespace metamath::finite_element {
+
+// Классический серендипов элемент пятого порядка, базис которого строится во время выполнения программы.
+// Пространство функций формы: полиномы пятой степени и одночлены xi^5 eta, xi eta^5.
+// Размерность пространства равна 23, поэтому к 20 граничным узлам добавляются 3 внутренних узла, не лежащих на одной прямой.
+// Это классическое пространство S5, а не замена параметризованного элемента quintic_serendipity с 20 узлами и параметром p.
+template<class T>
+class nodal_quintic_serendipity : public geometry_2d<T, rectangle_element_geometry> {
+protected:
+    explicit nodal_quintic_serendipity() = default;
+    ~nodal_quintic_serendipity() override = default;
+
+    // Нумерация узлов: 15--14--13--12--11--10
+    //                  |                   |
+    //                  16                  9
+    //                  |         22        |
+    //                  17                  8
+    //                  |                   |
+    //                  18                  7
+    //                  |    20        21   |
+    //                  19                  6
+    //                  |                   |
+    //                  0---1---2---3---4---5
+    static constexpr std::array<std::array<T, 2>, 23> nodes = { T{-1.0}, T{-1.0},
+                                                                T{-0.6}, T{-1.0},
+                                                                T{-0.2}, T{-1.0},
+                                                                T{ 0.2}, T{-1.0},
+                                                                T{ 0.6}, T{-1.0},
+                                                                T{ 1.0}, T{-1.0},
+                                                                T{ 1.0}, T{-0.6},
+                                                                T{ 1.0}, T{-0.2},
+                                                                T{ 1.0}, T{ 0.2},
+                                                                T{ 1.0}, T{ 0.6},
+                                                                T{ 1.0}, T{ 1.0},
+                                                                T{ 0.6}, T{ 1.0},
+                                                                T{ 0.2}, T{ 1.0},
+                                                                T{-0.2}, T{ 1.0},
+                                                                T{-0.6}, T{ 1.0},
+                                                                T{-1.0}, T{ 1.0},
+                                                                T{-1.0}, T{ 0.6},
+                                                                T{-1.0}, T{ 0.2},
+                                                                T{-1.0}, T{-0.2},
+                                                                T{-1.0}, T{-0.6},
+                                                                T{-0.5}, T{-0.5},
+                                                                T{ 0.5}, T{-0.5},
+                                                                T{ 0.0}, T{ 0.5} };
+
+    static constexpr std::array<std::array<uint8_t, 2>, 23> monomials = { 0, 0,
+                                                                          1, 0, 0, 1,
+                                                                          2, 0, 1, 1, 0, 2,
+                                                                          3, 0, 2, 1, 1, 2, 0, 3,
+                                                                          4, 0, 3, 1, 2, 2, 1, 3, 0, 4,
+                                                                          5, 0, 4, 1, 3, 2, 2, 3, 1, 4, 0, 5,
+                                                                          5, 1, 1, 5 };
+};
+
+}
+
+#endif
@@ -2,7 +2,10 @@
 #define DERIVATIVE_FINITE_ELEMENT_2D_BASIS_HPP
 
 #include "derivative.hpp"
+#include "taylor.hpp"
 #include "to_function.hpp"
+#include "evaluate.hpp"
+#include "initialization_profile.hpp"
 
 namespace metamath::finite_element {
 
@@ -16,13 +19,102 @@ class derivative_element_2d_basis : public Element_Type<T> {
     static_assert(std::tuple_size<decltype(basis)>::value == nodes.size(), "The number of functions and nodes does not match.");
 
 protected:
-    static inline const std::array<std::function<T(const std::array<T, Parameters_Count>&)>, nodes.size()>
-        N    = symdiff::to_function<T, Parameters_Count>(basis),
-        Nxi  = symdiff::to_function<T, Parameters_Count>(symdiff::derivative<xi>(basis)),
-        Neta = symdiff::to_function<T, Parameters_Count>(symdiff::derivative<eta>(basis));
+    using function_table = std::array<std::function<T(const std::array<T, Parameters_Count>&)>, nodes.size()>;
+
+    struct basis_functions final {
+        function_table N, Nxi, Neta;
+    };
+
+    // Функции формы и их производные строятся при первом обращении, а не при запуске программы.
+    // Инициализация локальной статической переменной потокобезопасна, последующие обращения не требуют блокировок.
+    static const basis_functions& functions() {
+        static const basis_functions table = profile_initialization<Element_Type<T>>([] {
+            return basis_functions{symdiff::to_function<T, Parameters_Count>(basis),
+                                   symdiff::to_function<T, Parameters_Count>(symdiff::derivative<xi>(basis)),
+                                   symdiff::to_function<T, Parameters_Count>(symdiff::derivative<eta>(basis))};
+        });
+        return table;
+    }
+
+    // Вторые производные {Nxixi, Nxieta, Netaeta} выражения e в точке. Они получаются разложением в ряд Тейлора (symdiff::taylor)
+    // самого выражения и его первой производной по xi, поэтому символьные деревья вторых производных не строятся и не инстанцируются,
+    // а стоимость компиляции растёт линейно с размером выражения функции формы.
+    template<class E>
+    static std::array<T, 3> second_derivatives(const E& e, const std::array<T, Parameters_Count>& point) {
+        return {symdiff::taylor<xi, 2>(e, point).derivative(2),
+                symdiff::taylor<eta, 1>(symdiff::derivative<xi>(e), point).derivative(1),
+                symdiff::taylor<eta, 2>(e, point).derivative(2)};
+    }
+
+    // Вторые производные i-ой функции формы.
+    static std::array<T, 3> second_derivatives(const size_t i, const std::array<T, Parameters_Count>& point) {
+        return second_derivatives(i, point, std::make_index_sequence<nodes.size()>{});
+    }
 
     explicit derivative_element_2d_basis() = default;
     ~derivative_element_2d_basis() override = default;
+
+private:
+    template<size_t... I>
+    static std::array<T, 3> second_derivatives(const size_t i, const std::array<T, Parameters_Count>& point, const std::index_sequence<I...>&) {
+        std::array<T, 3> result = {};
+        ((I == i && (result = second_derivatives(std::get<I>(basis), point), true)) || ...);
+        return result;
+    }
+
+    // Таблицы вторых производных кортежа выражений functions, например функций формы или их производных по параметру.
+    template<class Tuple, class U, size_t... I>
+    static void tabulate_second_derivatives(const Tuple& functions, const std::vector<std::array<U, Parameters_Count>>& points,
+                                            U* const Nxixi, U* const Nxieta, U* const Netaeta, const std::index_sequence<I...>&) {
+        const auto tabulate_function = [&points, Nxixi, Nxieta, Netaeta](const size_t i, const auto& e) {
+            for(size_t k = 0; k < points.size(); ++k) {
+                std::array<T, Parameters_Count> point;
+                for(size_t d = 0; d < Parameters_Count; ++d)
+                    point[d] = static_cast<T>(points[k][d]);
+                const std::array<T, 3> values = second_derivatives(e, point);
+                if (Nxixi)   Nxixi  [i * points.size() + k] = static_cast<U>(values[0]);
+                if (Nxieta)  Nxieta [i * points.size() + k] = static_cast<U>(values[1]);
+                if (Netaeta) Netaeta[i * points.size() + k] = static_cast<U>(values[2]);
+            }
+        };
+        (tabulate_function(I, std::get<I>(functions)), ...);
+    }
+
+public:
+    // Пакетное вычисление функций формы и их производных в наборе точек, минуя обращение к std::function.
+    // Функции формы вычисляются в типе T, результат сохраняется в типе U по столбцам: N[i*points.size() + k].
+    // Таблицы, для которых передан нулевой указатель, не вычисляются.
+    template<class U>
+    static void tabulate(const std::vector<std::array<U, Parameters_Count>>& points, U* const N, U* const Nxi, U* const Neta) {
+        if (N)    symdiff::evaluate<T>(basis, points, N);
+        if (Nxi)  symdiff::evaluate<T>(symdiff::derivative<xi>(basis), points, Nxi);
+        if (Neta) symdiff::evaluate<T>(symdiff::derivative<eta>(basis), points, Neta);
+    }
+
+    // Вариант со вторыми производными, которые вычисляются функцией second_derivatives.
+    template<class U>
+    static void tabulate(const std::vector<std::array<U, Parameters_Count>>& points, U* const N, U* const Nxi, U* const Neta,
+                         U* const Nxixi, U* const Nxieta, U* const Netaeta) {
+        tabulate(points, N, Nxi, Neta);
+        if (Nxixi || Nxieta || Netaeta)
+            tabulate_second_derivatives(basis, points, Nxixi, Nxieta, Netaeta, std::make_index_sequence<nodes.size()>{});
+    }
+
+    // Аналогично для производных функций формы по переменной Var, например по параметру элемента.
+    template<uintmax_t Var, class U>
+    static void tabulate_derivative(const std::vector<std::array<U, Parameters_Count>>& points, U* const N, U* const Nxi, U* const Neta) {
+        if (N)    symdiff::evaluate<T>(symdiff::derivative<Var>(basis), points, N);
+        if (Nxi)  symdiff::evaluate<T>(symdiff::derivative<xi, Var>(basis), points, Nxi);
+        if (Neta) symdiff::evaluate<T>(symdiff::derivative<eta, Var>(basis), points, Neta);
+    }
+
+    template<uintmax_t Var, class U>
+    static void tabulate_derivative(const std::vector<std::array<U, Parameters_Count>>& points, U* const N, U* const Nxi, U* const Neta,
+                                    U* const Nxixi, U* const Nxieta, U* const Netaeta) {
+        tabulate_derivative<Var>(points, N, Nxi, Neta);
+        if (Nxixi || Nxieta || Netaeta)
+            tabulate_second_derivatives(symdiff::derivative<Var>(basis), points, Nxixi, Nxieta, Netaeta, std::make_index_sequence<nodes.size()>{});
+    }
 };
 
 }
@@ -0,0 +1,190 @@
+#ifndef FINITE_ELEMENT_DUBINER_TRIANGLE_2D_INTEGRATE_HPP
+#define FINITE_ELEMENT_DUBINER_TRIANGLE_2D_INTEGRATE_HPP
+
+#include <algorithm>
+#include "element_2d_dubiner.hpp"
+#include "quadrature_1d_base.hpp"
+#include "legendre.hpp"
+
+namespace metamath::finite_element {
+
+// Треугольный элемент Дубинера на сжатой квадратуре, который хранит только одномерные таблицы.
+// Квадратура строится так же, как в element_2d_integrate: xi_i = узлы quadrature_xi на [0, 1], eta_ij = (1 - xi_i) (1 + a_j) / 2,
+// где a_j --- узлы quadrature_eta на [-1, 1]. В этих узлах psi_pq = P_p(a_j) B_pq(xi_i), B_pq = c_pq (1 - xi)^p P_q^{(2p+1,0)}(2 xi - 1),
+// а производные раскладываются так же:
+// dpsi/dxi  = (1 + a) P_p'(a) B_pq / (1 - xi) + P_p(a) dB_pq/dxi,
+// dpsi/deta = 2 P_p'(a) B_pq / (1 - xi).
+// Поэтому интерполяция и интегрирование выполняются сумм-факторизацией: сначала свёртка по q, затем по p,
+// за O(n^2 Q + n Q^2) = O(n^3) действий вместо O(n^2 Q^2) = O(n^4) с полными таблицами.
+// Нумерация квадратурных узлов совпадает с element_2d_integrate: k = i * Q_eta + j.
+template<class T>
+class dubiner_triangle_2d_integrate : public element_2d<T, dubiner_triangle> {
+    using basis = dubiner_triangle<T>;
+
+    size_t _xi_qnodes_count = 0, _eta_qnodes_count = 0;
+    std::vector<T> _xi_weights, _eta_weights; // Веса с учётом отображения на треугольник: w_ij = _xi_weights[i] * _eta_weights[j].
+    std::vector<T> _P, _dP, _adP;             // P_p(a_j), P_p'(a_j), (1 + a_j) P_p'(a_j): [p * Q_eta + j].
+    std::vector<T> _B, _Bt, _dB;              // B_pq(xi_i), B_pq(xi_i) / (1 - xi_i), dB_pq/dxi(xi_i): [k * Q_xi + i].
+
+    size_t orders_count() const noexcept { return basis::order() + 1; }
+
+public:
+    using element_2d<T, dubiner_triangle>::nodes_count;
+
+    explicit dubiner_triangle_2d_integrate(const quadrature_1d_base<T>& quadrature, const size_t order)
+        : dubiner_triangle_2d_integrate{quadrature, quadrature, order} {}
+
+    explicit dubiner_triangle_2d_integrate(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta,
+                                           const size_t order)
+        : element_2d<T, dubiner_triangle>{order} {
+        set_quadrature(quadrature_xi, quadrature_eta);
+    }
+
+    ~dubiner_triangle_2d_integrate() override = default;
+
+    // Сжатая квадратура не должна содержать узел xi = 1, в котором сторона треугольника стягивается в вершину.
+    void set_quadrature(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) {
+        const T length_xi  = quadrature_xi .boundary(side_1d::RIGHT) - quadrature_xi .boundary(side_1d::LEFT),
+                length_eta = quadrature_eta.boundary(side_1d::RIGHT) - quadrature_eta.boundary(side_1d::LEFT);
+        const size_t n = orders_count(), Qx = quadrature_xi.nodes_count(), Qy = quadrature_eta.nodes_count();
+        _xi_qnodes_count = Qx;
+        _eta_qnodes_count = Qy;
+
+        _eta_weights.resize(Qy);
+        _P.resize(n * Qy);
+        _dP.resize(n * Qy);
+        _adP.resize(n * Qy);
+        std::vector<T> P(n), dP(n);
+        for(size_t j = 0; j < Qy; ++j) {
+            const T a = T{2} * (quadrature_eta.node(j)[0] - quadrature_eta.boundary(side_1d::LEFT)) / length_eta - T{1};
+            _eta_weights[j] = quadrature_eta.weight(j) / length_eta;
+            function::legendre_values(n - 1, a, P.data(), dP.data());
+            for(size_t p = 0; p < n; ++p) {
+                _P  [p * Qy + j] = P[p];
+                _dP [p * Qy + j] = dP[p];
+                _adP[p * Qy + j] = (T{1} + a) * dP[p];
+            }
+        }
+
+        _xi_weights.resize(Qx);
+        _B.resize(nodes_count() * Qx);
+        _Bt.resize(nodes_count() * Qx);
+        _dB.resize(nodes_count() * Qx);
+        std::vector<T> factors(3 * nodes_count());
+        for(size_t i = 0; i < Qx; ++i) {
+            const T xi = (quadrature_xi.node(i)[0] - quadrature_xi.boundary(side_1d::LEFT)) / length_xi, t = T{1} - xi;
+            if (t <= T{0})
+                throw std::domain_error{"The collapsed quadrature must not contain the collapsed vertex."};
+            _xi_weights[i] = quadrature_xi.weight(i) / length_xi * t;
+            basis::template jacobi_factors<T>(xi, factors.data());
+            for(size_t k = 0; k < nodes_count(); ++k) {
+                const size_t p = basis::modes()[k][0];
+                const T power = std::pow(t, T(p));
+                _B [k * Qx + i] = power * factors[3*k];
+                _Bt[k * Qx + i] = power / t * factors[3*k];
+                _dB[k * Qx + i] = power * factors[3*k + 1] - (p ? T(p) * power / t * factors[3*k] : T{0});
+            }
+        }
+    }
+
+    size_t xi_qnodes_count () const noexcept { return _xi_qnodes_count;  }
+    size_t eta_qnodes_count() const noexcept { return _eta_qnodes_count; }
+    size_t qnodes_count() const noexcept { return xi_qnodes_count() * eta_qnodes_count(); }
+
+    // Количество хранимых значений таблиц, включая веса.
+    size_t tables_size() const noexcept {
+        return _xi_weights.size() + _eta_weights.size() + _P.size() + _dP.size() + _adP.size() + _B.size() + _Bt.size() + _dB.size();
+    }
+
+    T weight(const size_t q) const noexcept {
+        return _xi_weights[q / eta_qnodes_count()] * _eta_weights[q % eta_qnodes_count()];
+    }
+
+    T qN(const size_t k, const size_t q) const noexcept {
+        const size_t i = q / eta_qnodes_count(), j = q % eta_qnodes_count(), p = basis::modes()[k][0];
+        return _P[p * eta_qnodes_count() + j] * _B[k * xi_qnodes_count() + i];
+    }
+
+    T qNxi(const size_t k, const size_t q) const noexcept {
+        const size_t i = q / eta_qnodes_count(), j = q % eta_qnodes_count(), p = basis::modes()[k][0];
+        return _adP[p * eta_qnodes_count() + j] * _Bt[k * xi_qnodes_count() + i] +
+               _P  [p * eta_qnodes_count() + j] * _dB[k * xi_qnodes_count() + i];
+    }
+
+    T qNeta(const size_t k, const size_t q) const noexcept {
+        const size_t i = q / eta_qnodes_count(), j = q % eta_qnodes_count(), p = basis::modes()[k][0];
+        return T{2} * _dP[p * eta_qnodes_count() + j] * _Bt[k * xi_qnodes_count() + i];
+    }
+
+    // Размер рабочего массива, необходимого функциям interpolate и integrate.
+    size_t workspace_size() const noexcept { return 3 * orders_count() * xi_qnodes_count(); }
+
+    // Значения u_h = sum_k u_k psi_k и её производных в квадратурных узлах. Нулевые указатели values, dxi, deta пропускаются.
+    // Сначала вычисляются свёртки C_p(i) = sum_q u_pq B_pq(xi_i), затем суммы по p в каждом узле.
+    void interpolate(const T* const u, T* const values, T* const dxi, T* const deta, T* const workspace) const {
+        const size_t n = orders_count(), Qx = xi_qnodes_count(), Qy = eta_qnodes_count();
+        T* const C  = workspace;
+        T* const Ct = C  + n * Qx;
+        T* const dC = Ct + n * Qx;
+        std::fill(workspace, workspace + workspace_size(), T{0});
+        for(size_t k = 0; k < nodes_count(); ++k) {
+            const size_t p = basis::modes()[k][0];
+            for(size_t i = 0; i < Qx; ++i) {
+                C [p * Qx + i] += u[k] * _B [k * Qx + i];
+                Ct[p * Qx + i] += u[k] * _Bt[k * Qx + i];
+                dC[p * Qx + i] += u[k] * _dB[k * Qx + i];
+            }
+        }
+
+        for(size_t i = 0; i < Qx; ++i)
+            for(size_t j = 0; j < Qy; ++j) {
+                T value = T{0}, value_xi = T{0}, value_eta = T{0};
+                for(size_t p = 0; p < n; ++p) {
+                    value     += _P[p * Qy + j] * C[p * Qx + i];
+                    value_xi  += _adP[p * Qy + j] * Ct[p * Qx + i] + _P[p * Qy + j] * dC[p * Qx + i];
+                    value_eta += _dP[p * Qy + j] * Ct[p * Qx + i];
+                }
+                const size_t q = i * Qy + j;
+                if (values) values[q] = value;
+                if (dxi)    dxi   [q] = value_xi;
+                if (deta)   deta  [q] = T{2} * value_eta;
+            }
+    }
+
+    // Интегралы r_k = sum_q w_q (f_q psi_k + g_q dpsi_k/dxi + h_q dpsi_k/deta) --- операция, транспонированная к interpolate.
+    // Нулевые указатели f, g, h означают нулевые величины. Сначала выполняется свёртка по eta, затем по xi.
+    void integrate(const T* const f, const T* const g, const T* const h, T* const result, T* const workspace) const {
+        const size_t n = orders_count(), Qx = xi_qnodes_count(), Qy = eta_qnodes_count();
+        T* const D  = workspace;
+        T* const Dt = D  + n * Qx;
+        T* const dD = Dt + n * Qx;
+
+        for(size_t p = 0; p < n; ++p)
+            for(size_t i = 0; i < Qx; ++i) {
+                T sum = T{0}, sum_t = T{0}, sum_d = T{0};
+                for(size_t j = 0; j < Qy; ++j) {
+                    const size_t q = i * Qy + j;
+                    const T w = _xi_weights[i] * _eta_weights[j];
+                    if (f) sum   += w * f[q] * _P[p * Qy + j];
+                    if (g) sum_t += w * g[q] * _adP[p * Qy + j];
+                    if (h) sum_t += w * h[q] * T{2} * _dP[p * Qy + j];
+                    if (g) sum_d += w * g[q] * _P[p * Qy + j];
+                }
+                D [p * Qx + i] = sum;
+                Dt[p * Qx + i] = sum_t;
+                dD[p * Qx + i] = sum_d;
+            }
+
+        for(size_t k = 0; k < nodes_count(); ++k) {
+            const size_t p = basis::modes()[k][0];
+            T sum = T{0};
+            for(size_t i = 0; i < Qx; ++i)
+                sum += _B[k * Qx + i] * D[p * Qx + i] + _Bt[k * Qx + i] * Dt[p * Qx + i] + _dB[k * Qx + i] * dD[p * Qx + i];
+            result[k] = sum;
+        }
+    }
+};
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef FINITE_ELEMENT_2D_HPP
 #define FINITE_ELEMENT_2D_HPP
 
+#include <utility>
 #include "element_2d_base.hpp"
 #include "derivative_element_2d_basis.hpp"
 
@@ -14,17 +15,51 @@ class element_2d : public virtual element_2d_base<T>,
     using derivative_base = derivative_element_2d_basis<T, Element_Type, 2>;
 
 public:
+    // Зависят ли функции формы от параметра элемента.
+    static constexpr bool parametric = false;
+
     ~element_2d() override = default;
 
-    size_t nodes_count() const override { return derivative_base::N.size(); }
+    size_t nodes_count() const override { return Element_Type<T>::nodes.size(); }
 
     const std::array<T, 2>& node(const size_t i) const override { return Element_Type<T>::nodes[i]; }
 
-    T N   (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::N   [i](xi); }
-    T Nxi (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::Nxi [i](xi); }
-    T Neta(const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::Neta[i](xi); }
+    T N   (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::functions().N   [i](xi); }
+    T Nxi (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::functions().Nxi [i](xi); }
+    T Neta(const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::functions().Neta[i](xi); }
+
+    T Nxixi  (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::second_derivatives(i, xi)[0]; }
+    T Nxieta (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::second_derivatives(i, xi)[1]; }
+    T Netaeta(const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::second_derivatives(i, xi)[2]; }
 
     T boundary(const side_2d bound, const T x) const override { return Element_Type<T>::boundary(bound, x); }
+
+    void tabulate(const std::vector<std::array<T, 2>>& points, const derivative_2d mask, T* out) const override {
+        const auto block = [&out, mask, size = nodes_count() * points.size()](const derivative_2d flag) {
+            return mask & flag ? std::exchange(out, out + size) : nullptr;
+        };
+        T* const N       = block(derivative_2d::N);
+        T* const Nxi     = block(derivative_2d::XI);
+        T* const Neta    = block(derivative_2d::ETA);
+        T* const Nxixi   = block(derivative_2d::XIXI);
+        T* const Nxieta  = block(derivative_2d::XIETA);
+        T* const Netaeta = block(derivative_2d::ETAETA);
+        tabulate_basis<T>(points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+
+protected:
+    // Параметры элемента, от которых зависят функции формы. Используются для идентификации табуляций.
+    std::vector<T> parameters() const { return {}; }
+
+    // Пакетное вычисление функций формы в типе Eval_T, результат сохраняется в типе T.
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 2>>& points, T* const N, T* const Nxi, T* const Neta,
+                        T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr) const {
+        if (Nxixi || Nxieta || Netaeta)
+            derivative_element_2d_basis<Eval_T, Element_Type, 2>::tabulate(points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+        else
+            derivative_element_2d_basis<Eval_T, Element_Type, 2>::tabulate(points, N, Nxi, Neta);
+    }
 };
 
 }
@@ -1,12 +1,27 @@
 #ifndef ELEMENT_2D_BASE_HPP
 #define ELEMENT_2D_BASE_HPP
 
+#include <cmath>
 #include <array>
+#include <limits>
+#include <vector>
+#include <cstdint>
 #include "element_base.hpp"
 #include "geometry_2d.hpp"
 
 namespace metamath::finite_element {
 
+// Маска величин, вычисляемых при пакетном вычислении функций формы.
+enum class derivative_2d : uint8_t { N = 1, XI = 2, ETA = 4, XIXI = 8, XIETA = 16, ETAETA = 32 };
+
+constexpr derivative_2d operator|(const derivative_2d lhs, const derivative_2d rhs) noexcept {
+    return derivative_2d(uint8_t(lhs) | uint8_t(rhs));
+}
+
+constexpr bool operator&(const derivative_2d mask, const derivative_2d flag) noexcept {
+    return uint8_t(mask) & uint8_t(flag);
+}
+
 template<class T>
 class element_2d_base : public element_base {
     static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
@@ -19,10 +34,50 @@ public:
     virtual T N   (const size_t i, const std::array<T, 2>& xi) const = 0; // Обращение к i-ой функции формы в точке (xi, eta).
     virtual T Nxi (const size_t i, const std::array<T, 2>& xi) const = 0; // Аналогично для производных.
     virtual T Neta(const size_t i, const std::array<T, 2>& xi) const = 0;
+    virtual T Nxixi  (const size_t i, const std::array<T, 2>& xi) const = 0; // Вторые производные.
+    virtual T Nxieta (const size_t i, const std::array<T, 2>& xi) const = 0;
+    virtual T Netaeta(const size_t i, const std::array<T, 2>& xi) const = 0;
 
     virtual T boundary(const side_2d bound, const T x) const = 0; // Геометрия элемента.
+
+    // Является ли элемент узловым: N_i(node(j)) = delta_ij, так что коэффициенты разложения являются значениями в узлах.
+    // Модальные и иерархические элементы переопределяют метод, их узлы условны и могут совпадать.
+    virtual bool nodal() const { return true; }
+
+    // Номера функций формы, которые обращаются в ноль на всей границе элемента. Такие функции связаны только с функциями
+    // своего элемента и могут быть исключены статической конденсацией. Для узловых элементов это функции узлов,
+    // лежащих строго внутри элемента; модальные элементы, функции которых не связаны с узлами, переопределяют метод.
+    virtual std::vector<size_t> interior_nodes() const {
+        const T tolerance = std::sqrt(std::numeric_limits<T>::epsilon());
+        std::vector<size_t> result;
+        for(size_t i = 0; i < nodes_count(); ++i) {
+            const auto [xi, eta] = node(i);
+            if (xi  > boundary(side_2d::LEFT, eta) + tolerance && xi  < boundary(side_2d::RIGHT, eta) - tolerance &&
+                eta > boundary(side_2d::DOWN, xi ) + tolerance && eta < boundary(side_2d::UP,    xi ) - tolerance)
+                result.push_back(i);
+        }
+        return result;
+    }
+
+    // Пакетное вычисление функций формы и их производных в наборе точек.
+    // Для каждой величины из маски в порядке N, XI, ETA, XIXI, XIETA, ETAETA в out записывается блок размером nodes_count() * points.size()
+    // по столбцам: out[i*points.size() + k]. Наследники переопределяют метод, избегая обращения к функциям по одной.
+    virtual void tabulate(const std::vector<std::array<T, 2>>& points, const derivative_2d mask, T* out) const {
+        const auto fill = [this, &points, &out](const auto& function) {
+            for(size_t i = 0; i < nodes_count(); ++i)
+                for(size_t k = 0; k < points.size(); ++k)
+                    out[i*points.size() + k] = function(i, points[k]);
+            out += nodes_count() * points.size();
+        };
+        if (mask & derivative_2d::N)      fill([this](const size_t i, const std::array<T, 2>& xi) { return N      (i, xi); });
+        if (mask & derivative_2d::XI)     fill([this](const size_t i, const std::array<T, 2>& xi) { return Nxi    (i, xi); });
+        if (mask & derivative_2d::ETA)    fill([this](const size_t i, const std::array<T, 2>& xi) { return Neta   (i, xi); });
+        if (mask & derivative_2d::XIXI)   fill([this](const size_t i, const std::array<T, 2>& xi) { return Nxixi  (i, xi); });
+        if (mask & derivative_2d::XIETA)  fill([this](const size_t i, const std::array<T, 2>& xi) { return Nxieta (i, xi); });
+        if (mask & derivative_2d::ETAETA) fill([this](const size_t i, const std::array<T, 2>& xi) { return Netaeta(i, xi); });
+    }
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,109 @@
+#ifndef FINITE_ELEMENT_2D_DUBINER_HPP
+#define FINITE_ELEMENT_2D_DUBINER_HPP
+
+#include "element_2d.hpp"
+#include "element_1d_hierarchical.hpp"
+#include "basis/dubiner_triangle.hpp"
+
+namespace metamath::finite_element {
+
+template<>
+inline constexpr bool is_hierarchical_v<dubiner_triangle> = true;
+
+// Треугольные элементы Дубинера произвольного порядка. Порядок задаётся при создании элемента
+// и передаётся через конструктор element_2d_integrate: element_2d_integrate<T, dubiner_triangle>{quadrature, order}.
+template<class T>
+class element_2d_dubiner : public virtual element_2d_base<T>,
+                           public dubiner_triangle<T> {
+    using basis = dubiner_triangle<T>;
+
+    T value(const size_t i, const std::array<T, 2>& xi, const size_t component) const {
+        std::vector<T> values(nodes_count());
+        std::array<T*, 6> out = {};
+        out[component] = values.data();
+        basis::template evaluate<T>(xi, out[0], out[1], out[2], 1, out[3], out[4], out[5]);
+        return values[i];
+    }
+
+public:
+    static constexpr bool parametric = false;
+
+    explicit element_2d_dubiner(const size_t order)
+        : basis{order} {}
+
+    ~element_2d_dubiner() override = default;
+
+    size_t nodes_count() const override { return basis::_modes.size(); }
+
+    const std::array<T, 2>& node(const size_t i) const override { return basis::_nodes[i]; }
+
+    T N   (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 0); }
+    T Nxi (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 1); }
+    T Neta(const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 2); }
+
+    T Nxixi  (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 3); }
+    T Nxieta (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 4); }
+    T Netaeta(const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 5); }
+
+    T boundary(const side_2d bound, const T x) const override { return basis::boundary(bound, x); }
+
+    bool nodal() const override { return false; }
+
+    // Функции ортогонального базиса не обращаются в ноль на границе треугольника, поэтому внутренних функций нет,
+    // хотя условные узлы всех функций лежат в центре треугольника.
+    std::vector<size_t> interior_nodes() const override { return {}; }
+
+    void tabulate(const std::vector<std::array<T, 2>>& points, const derivative_2d mask, T* out) const override {
+        const auto block = [&out, mask, size = nodes_count() * points.size()](const derivative_2d flag) {
+            return mask & flag ? std::exchange(out, out + size) : nullptr;
+        };
+        T* const N       = block(derivative_2d::N);
+        T* const Nxi     = block(derivative_2d::XI);
+        T* const Neta    = block(derivative_2d::ETA);
+        T* const Nxixi   = block(derivative_2d::XIXI);
+        T* const Nxieta  = block(derivative_2d::XIETA);
+        T* const Netaeta = block(derivative_2d::ETAETA);
+        tabulate_basis<T>(points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+
+    // Смена порядка элемента. Элементы с таблицами меняют порядок своими методами set_order, которые обновляют таблицы.
+    void set_order(const size_t order) { basis::set_order(order); }
+
+protected:
+    std::vector<T> parameters() const { return {T(basis::order())}; }
+
+    // Пакетное вычисление функций формы с номерами от first в типе Eval_T, результат сохраняется в типе T.
+    // Множители Якоби пересчитываются только при смене координаты xi, поэтому на квадратурных узлах element_2d_integrate,
+    // упорядоченных по xi, они вычисляются один раз на узел по xi, а стоимость табуляции составляет O(n^2) на точку.
+    template<class Eval_T>
+    void tabulate_modes(const std::vector<std::array<T, 2>>& points, const size_t first, T* const N, T* const Nxi, T* const Neta,
+                        T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr) const {
+        const auto shift = [](T* const table, const size_t k) { return table ? table + k : nullptr; };
+        std::vector<Eval_T> factors(3 * nodes_count());
+        for(size_t k = 0; k < points.size(); ++k) {
+            if (k == 0 || points[k][0] != points[k-1][0])
+                basis::template jacobi_factors<Eval_T>(points[k][0], factors.data());
+            basis::template evaluate<Eval_T>(points[k], factors.data(), shift(N, k), shift(Nxi, k), shift(Neta, k), points.size(),
+                                             shift(Nxixi, k), shift(Nxieta, k), shift(Netaeta, k), first);
+        }
+    }
+
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 2>>& points, T* const N, T* const Nxi, T* const Neta,
+                        T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr) const {
+        tabulate_modes<Eval_T>(points, 0, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+};
+
+template<class T>
+class element_2d<T, dubiner_triangle> : public element_2d_dubiner<T> {
+public:
+    explicit element_2d(const size_t order)
+        : element_2d_dubiner<T>{order} {}
+
+    ~element_2d() override = default;
+};
+
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef FINITE_ELEMENT_2D_HIERARCHICAL_HPP
+#define FINITE_ELEMENT_2D_HIERARCHICAL_HPP
+
+#include "element_2d.hpp"
+#include "element_1d_hierarchical.hpp"
+#include "basis/hierarchical_quadrilateral.hpp"
+
+namespace metamath::finite_element {
+
+template<>
+inline constexpr bool is_hierarchical_v<hierarchical_quadrilateral> = true;
+
+// Иерархические четырёхугольные элементы произвольного порядка. Порядок задаётся при создании элемента
+// и передаётся через конструктор element_2d_integrate: element_2d_integrate<T, hierarchical_quadrilateral>{quadrature, order}.
+template<class T>
+class element_2d_hierarchical : public virtual element_2d_base<T>,
+                                public hierarchical_quadrilateral<T> {
+    using basis = hierarchical_quadrilateral<T>;
+
+    T value(const size_t i, const std::array<T, 2>& xi, const size_t component) const {
+        std::vector<T> values(nodes_count());
+        std::array<T*, 6> out = {};
+        out[component] = values.data();
+        basis::template evaluate<T>(xi, out[0], out[1], out[2], 1, out[3], out[4], out[5]);
+        return values[i];
+    }
+
+public:
+    static constexpr bool parametric = false;
+
+    explicit element_2d_hierarchical(const size_t order)
+        : basis{order} {}
+
+    ~element_2d_hierarchical() override = default;
+
+    size_t nodes_count() const override { return basis::_modes.size(); }
+
+    const std::array<T, 2>& node(const size_t i) const override { return basis::_nodes[i]; }
+
+    T N   (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 0); }
+    T Nxi (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 1); }
+    T Neta(const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 2); }
+
+    T Nxixi  (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 3); }
+    T Nxieta (const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 4); }
+    T Netaeta(const size_t i, const std::array<T, 2>& xi) const override { return value(i, xi, 5); }
+
+    T boundary(const side_2d bound, const T x) const override { return basis::boundary(bound, x); }
+
+    bool nodal() const override { return false; }
+
+    // На всей границе элемента обращаются в ноль только произведения внутренних одномерных функций N_i(xi) N_j(eta), i, j >= 2.
+    std::vector<size_t> interior_nodes() const override {
+        std::vector<size_t> result;
+        for(size_t k = 0; k < nodes_count(); ++k)
+            if (basis::_modes[k][0] >= 2 && basis::_modes[k][1] >= 2)
+                result.push_back(k);
+        return result;
+    }
+
+    void tabulate(const std::vector<std::array<T, 2>>& points, const derivative_2d mask, T* out) const override {
+        const auto block = [&out, mask, size = nodes_count() * points.size()](const derivative_2d flag) {
+            return mask & flag ? std::exchange(out, out + size) : nullptr;
+        };
+        T* const N       = block(derivative_2d::N);
+        T* const Nxi     = block(derivative_2d::XI);
+        T* const Neta    = block(derivative_2d::ETA);
+        T* const Nxixi   = block(derivative_2d::XIXI);
+        T* const Nxieta  = block(derivative_2d::XIETA);
+        T* const Netaeta = block(derivative_2d::ETAETA);
+        tabulate_basis<T>(points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+
+    // Смена порядка элемента. Элементы с таблицами меняют порядок своими методами set_order, которые обновляют таблицы.
+    void set_order(const size_t order) { basis::set_order(order); }
+
+protected:
+    std::vector<T> parameters() const { return {T(basis::order())}; }
+
+    // Пакетное вычисление функций формы с номерами от first в типе Eval_T, результат сохраняется в типе T.
+    template<class Eval_T>
+    void tabulate_modes(const std::vector<std::array<T, 2>>& points, const size_t first, T* const N, T* const Nxi, T* const Neta,
+                        T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr) const {
+        const auto shift = [](T* const table, const size_t k) { return table ? table + k : nullptr; };
+        for(size_t k = 0; k < points.size(); ++k)
+            basis::template evaluate<Eval_T>(points[k], shift(N, k), shift(Nxi, k), shift(Neta, k), points.size(),
+                                             shift(Nxixi, k), shift(Nxieta, k), shift(Netaeta, k), first);
+    }
+
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 2>>& points, T* const N, T* const Nxi, T* const Neta,
+                        T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr) const {
+        tabulate_modes<Eval_T>(points, 0, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+};
+
+template<class T>
+class element_2d<T, hierarchical_quadrilateral> : public element_2d_hierarchical<T> {
+public:
+    explicit element_2d(const size_t order)
+        : element_2d_hierarchical<T>{order} {}
+
+    ~element_2d() override = default;
+};
+
+}
+
+#endif
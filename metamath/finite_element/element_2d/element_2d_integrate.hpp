@@ -3,16 +3,78 @@
 
 #include "element_2d_integrate_base.hpp"
 #include "element_2d.hpp"
+#include "element_2d_hierarchical.hpp"
+#include "element_2d_dubiner.hpp"
 
 namespace metamath::finite_element {
 
-template<class T, template<class> class Element_Type>
+// Eval_T --- тип, в котором вычисляются функции формы при построении таблиц. Веса и таблицы хранятся в типе T.
+// Вычисление в типе меньшей точности (например, float при T = double) ускоряет только построение таблиц ценой контролируемой потери точности:
+// значения округляются до Eval_T и записываются в таблицы типа T, а все ядра, использующие таблицы, читают и накапливают их в типе T.
+template<class T, template<class> class Element_Type, class Eval_T = T>
 class element_2d_integrate : public element_2d_integrate_base<T>,
                              public element_2d<T, Element_Type> {
-    using element_2d_integrate_base<T>::_weights;
-    using element_2d_integrate_base<T>::_qN;
-    using element_2d_integrate_base<T>::_qNxi;
-    using element_2d_integrate_base<T>::_qNeta;
+    static_assert(std::is_floating_point_v<Eval_T>, "The Eval_T must be floating point.");
+
+protected:
+    using element_2d_integrate_base<T>::set_tabulation;
+    using element_2d_integrate_base<T>::_quadrature_xi;
+    using element_2d_integrate_base<T>::_quadrature_eta;
+
+    std::shared_ptr<const affine_tabulation<T>> _affine = nullptr; // Используется только элементами, зависящими от параметра.
+
+    // Квадратурные узлы и веса на элементе.
+    std::pair<std::vector<std::array<T, 2>>, std::vector<T>> quadrature_points(const quadrature_1d_base<T>& quadrature_xi,
+                                                                              const quadrature_1d_base<T>& quadrature_eta) const {
+        T jacobian_xi = (              boundary(side_2d::RIGHT, 0) -               boundary(side_2d::LEFT, 0)) /
+                        (quadrature_xi.boundary(side_1d::RIGHT   ) - quadrature_xi.boundary(side_1d::LEFT   ));
+        std::vector<std::array<T, 2>> points(quadrature_xi.nodes_count() * quadrature_eta.nodes_count());
+        std::vector<T> weights(quadrature_xi.nodes_count() * quadrature_eta.nodes_count());
+        for(size_t i = 0; i < quadrature_xi.nodes_count(); ++i) {
+            const T xi = boundary(side_2d::LEFT, 0) + (quadrature_xi.node(i)[0] - quadrature_xi.boundary(side_1d::LEFT)) * jacobian_xi;
+            const T jacobian_eta = (               boundary(side_2d::UP, xi) -                boundary(side_2d::DOWN, xi)) /
+                                   (quadrature_eta.boundary(side_1d::RIGHT ) - quadrature_eta.boundary(side_1d::LEFT    ));
+            for(size_t j = 0; j < quadrature_eta.nodes_count(); ++j) {
+                const T eta = boundary(side_2d::DOWN, xi) + (quadrature_eta.node(j)[0]-quadrature_eta.boundary(side_1d::LEFT)) * jacobian_eta;
+                points[i*quadrature_eta.nodes_count() + j] = {xi, eta};
+                weights[i*quadrature_eta.nodes_count() + j] = quadrature_xi.weight(i) * jacobian_xi * quadrature_eta.weight(j) * jacobian_eta;
+            }
+        }
+        return {std::move(points), std::move(weights)};
+    }
+
+    // Квадратуры берутся из реестра, поэтому элементы с одними квадратурами разделяют их копии.
+    void set_shared_quadrature(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) {
+        const auto shared_quadrature = [](const quadrature_1d_base<T>& quadrature) {
+            return shared_registry<std::type_index, quadrature_1d_base<T>>::instance().get(typeid(quadrature), [&quadrature] {
+                return std::shared_ptr<const quadrature_1d_base<T>>{quadrature.clone()};
+            });
+        };
+        _quadrature_xi  = shared_quadrature(quadrature_xi);
+        _quadrature_eta = shared_quadrature(quadrature_eta);
+    }
+
+    // Таблицы A и B элемента, зависящего от параметра, из которых таблицы при параметре p получаются как A + p B.
+    void set_shared_affine(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) {
+        const size_t components = second_derivatives() ? 6 : 3;
+        _affine = shared_registry<tabulation_key<T>, affine_tabulation<T>>::instance().get(
+            {typeid(element_2d_integrate), {typeid(quadrature_xi), typeid(quadrature_eta)}, {}, layout(), second_derivatives()},
+            [this, &quadrature_xi, &quadrature_eta, components] {
+            const auto [points, weights] = quadrature_points(quadrature_xi, quadrature_eta);
+            const size_t size = element_2d<T, Element_Type>::nodes_count() * weights.size();
+            std::vector<std::vector<T>> A(components, std::vector<T>(size)), B(components, std::vector<T>(size));
+            std::array<T*, 6> A_data = {}, B_data = {};
+            std::vector<const T*> A_tables(components), B_tables(components);
+            for(size_t c = 0; c < components; ++c) {
+                A_tables[c] = A_data[c] = A[c].data();
+                B_tables[c] = B_data[c] = B[c].data();
+            }
+            element_2d<T, Element_Type>::template tabulate_affine<Eval_T>(points, A_data, B_data);
+            return std::make_shared<const affine_tabulation<T>>(
+                tabulation<T>{layout(), weights, element_2d<T, Element_Type>::nodes_count(), A_tables},
+                tabulation<T>{layout(), weights, element_2d<T, Element_Type>::nodes_count(), B_tables});
+        });
+    }
 
 public:
     using element_2d_integrate_base<T>::qnodes_count;
@@ -20,50 +82,133 @@ public:
     using element_2d<T, Element_Type>::N;
     using element_2d<T, Element_Type>::Nxi;
     using element_2d<T, Element_Type>::Neta;
+    using element_2d<T, Element_Type>::Nxixi;
+    using element_2d<T, Element_Type>::Nxieta;
+    using element_2d<T, Element_Type>::Netaeta;
     using element_2d<T, Element_Type>::boundary;
+    using element_2d<T, Element_Type>::tabulate;
 
-    explicit element_2d_integrate(const quadrature_1d_base<T>& quadrature) {
+    using element_2d_integrate_base<T>::layout;
+    using element_2d_integrate_base<T>::set_layout;
+    using element_2d_integrate_base<T>::set_cache;
+    using element_2d_integrate_base<T>::second_derivatives;
+    using element_2d_integrate_base<T>::set_second_derivatives;
+
+    explicit element_2d_integrate(const quadrature_1d_base<T>& quadrature, const table_layout layout = table_layout::NODE_MAJOR) {
+        set_layout(layout);
         set_quadrature(quadrature, quadrature);
     }
 
-    explicit element_2d_integrate(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) {
+    explicit element_2d_integrate(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta,
+                                  const table_layout layout = table_layout::NODE_MAJOR) {
+        set_layout(layout);
         set_quadrature(quadrature_xi, quadrature_eta);
     }
 
+    // Таблицы, отсутствующие в процессе, отображаются в память из кэша на диске без вычисления функций формы,
+    // а при их отсутствии в кэше строятся и сохраняются в него.
+    explicit element_2d_integrate(std::shared_ptr<const tabulation_cache<T>> cache, const quadrature_1d_base<T>& quadrature,
+                                  const table_layout layout = table_layout::NODE_MAJOR)
+        : element_2d_integrate{std::move(cache), quadrature, quadrature, layout} {}
+
+    explicit element_2d_integrate(std::shared_ptr<const tabulation_cache<T>> cache, const quadrature_1d_base<T>& quadrature_xi,
+                                  const quadrature_1d_base<T>& quadrature_eta, const table_layout layout = table_layout::NODE_MAJOR) {
+        set_cache(std::move(cache));
+        set_layout(layout);
+        set_quadrature(quadrature_xi, quadrature_eta);
+    }
+
+    // Конструктор для элементов, параметры которых задаются во время выполнения программы, например порядок элемента.
+    // Аргументы args передаются конструктору element_2d<T, Element_Type>.
+    template<class... Args, class = std::enable_if_t<sizeof...(Args) != 0 && std::is_constructible_v<element_2d<T, Element_Type>, Args&&...>>>
+    explicit element_2d_integrate(const quadrature_1d_base<T>& quadrature, Args&&... args)
+        : element_2d<T, Element_Type>{std::forward<Args>(args)...} {
+        set_quadrature(quadrature, quadrature);
+    }
+
     ~element_2d_integrate() override = default;
 
+protected:
+    // Конструктор для наследников, которые заполняют таблицы самостоятельно.
+    explicit element_2d_integrate() = default;
+
+public:
+
     // Узлы в которых происходит расчёт получаются путём декартова произведения квадратур с учётом того,
     // что геометрия описывается таким образом, что параметрическую зависимость имеет верхняя и нижняя границы,
     // а правая и левая заданы константами.
-    void set_quadrature(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) override
-    {
-        T jacobian_xi = (              boundary(side_2d::RIGHT, 0) -               boundary(side_2d::LEFT, 0)) /
-                        (quadrature_xi.boundary(side_1d::RIGHT   ) - quadrature_xi.boundary(side_1d::LEFT   ));
-        std::vector<T> jacobian_eta(quadrature_xi.nodes_count()),
-                xi(quadrature_xi.nodes_count()),
-                eta(quadrature_eta.nodes_count());
+    // Таблицы берутся из реестра, поэтому элементы одного типа с одними квадратурами и параметрами разделяют общие данные.
+    void set_quadrature(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) override {
+        set_shared_quadrature(quadrature_xi, quadrature_eta);
+        const size_t components = second_derivatives() ? 6 : 3;
+        if constexpr (element_2d<T, Element_Type>::parametric) {
+            set_shared_affine(quadrature_xi, quadrature_eta);
+            set_tabulation(typeid(element_2d_integrate), {typeid(quadrature_xi), typeid(quadrature_eta)}, element_2d<T, Element_Type>::parameters(),
+                           [this] { return std::make_shared<const tabulation<T>>((*_affine)(element_2d<T, Element_Type>::parameters().front())); });
+        } else
+            set_tabulation(typeid(element_2d_integrate), {typeid(quadrature_xi), typeid(quadrature_eta)}, element_2d<T, Element_Type>::parameters(),
+                           [this, &quadrature_xi, &quadrature_eta, components] {
+                const auto [points, weights] = quadrature_points(quadrature_xi, quadrature_eta);
+                const size_t size = element_2d<T, Element_Type>::nodes_count() * weights.size();
+                std::vector<std::vector<T>> tables(components, std::vector<T>(size));
+                std::array<T*, 6> data = {};
+                for(size_t c = 0; c < components; ++c)
+                    data[c] = tables[c].data();
+                element_2d<T, Element_Type>::template tabulate_basis<Eval_T>(points, data[0], data[1], data[2], data[3], data[4], data[5]);
+                return std::make_shared<const tabulation<T>>(layout(), weights, element_2d<T, Element_Type>::nodes_count(),
+                                                             std::vector<const T*>(data.cbegin(), data.cbegin() + components));
+            });
+    }
 
-        _weights.resize(quadrature_xi.nodes_count() * quadrature_eta.nodes_count());
-        for(size_t i = 0; i < quadrature_xi.nodes_count(); ++i) {
-            xi[i] = boundary(side_2d::LEFT, 0) + (quadrature_xi.node(i)[0] - quadrature_xi.boundary(side_1d::LEFT)) * jacobian_xi;
-            jacobian_eta[i] = (               boundary(side_2d::UP, xi[i]) -                boundary(side_2d::DOWN, xi[i])) /
-                              (quadrature_eta.boundary(side_1d::RIGHT    ) - quadrature_eta.boundary(side_1d::LEFT       ));
-            for(size_t j = 0; j < quadrature_eta.nodes_count(); ++j) {
-                eta[j] = boundary(side_2d::DOWN, xi[i]) + (quadrature_eta.node(j)[0]-quadrature_eta.boundary(side_1d::LEFT)) * jacobian_eta[i];
-                _weights[i*quadrature_eta.nodes_count() + j] = quadrature_xi.weight(i) * jacobian_xi * quadrature_eta.weight(j) * jacobian_eta[i];
-            }
-        }
+    // Табуляции на сторонах элемента. Функции формы вычисляются в тех же узлах, что и внутренние таблицы, при текущих параметрах.
+    void set_edge_quadrature(const quadrature_1d_base<T>& quadrature) override {
+        element_2d_integrate_base<T>::set_edge_tabulations(typeid(element_2d_integrate), quadrature, element_2d<T, Element_Type>::parameters(),
+                                                           [this](const std::vector<std::array<T, 2>>& points, const std::vector<T>& weights) {
+            const size_t size = element_2d<T, Element_Type>::nodes_count() * weights.size();
+            std::vector<T> qN(size), qNxi(size), qNeta(size);
+            element_2d<T, Element_Type>::template tabulate_basis<Eval_T>(points, qN.data(), qNxi.data(), qNeta.data());
+            return std::make_shared<const tabulation<T>>(layout(), weights, element_2d<T, Element_Type>::nodes_count(),
+                                                         std::vector<const T*>{qN.data(), qNxi.data(), qNeta.data()});
+        });
+    }
+
+    // Смена параметра элемента. Таблицы получаются из A + p B без повторного вычисления функций формы.
+    template<bool Parametric = element_2d<T, Element_Type>::parametric>
+    std::enable_if_t<Parametric> set_parameter(const T p) {
+        element_2d<T, Element_Type>::set_parameter(p);
+        set_tabulation(element_2d<T, Element_Type>::parameters(), [this, p] {
+            const tabulation<T> result = (*_affine)(p);
+            return result.layout() == layout() ? std::make_shared<const tabulation<T>>(result) :
+                                                 std::make_shared<const tabulation<T>>(result, layout());
+        });
+        if (const std::shared_ptr<const quadrature_1d_base<T>> quadrature = element_2d_integrate_base<T>::edge_quadrature())
+            set_edge_quadrature(*quadrature);
+    }
 
-        _qN.resize(element_2d<T, Element_Type>::nodes_count() * qnodes_count());
-        _qNxi.resize(element_2d<T, Element_Type>::nodes_count() * qnodes_count());
-        _qNeta.resize(element_2d<T, Element_Type>::nodes_count() * qnodes_count());
-        for(size_t i = 0; i < nodes_count(); ++i)
-            for(size_t j = 0; j < quadrature_xi.nodes_count(); ++j)
-                for(size_t k = 0; k < quadrature_eta.nodes_count(); ++k) {
-                    _qN   [i*qnodes_count() + j*quadrature_eta.nodes_count() + k] = N   (i, {xi[j], eta[k]});
-                    _qNxi [i*qnodes_count() + j*quadrature_eta.nodes_count() + k] = Nxi (i, {xi[j], eta[k]});
-                    _qNeta[i*qnodes_count() + j*quadrature_eta.nodes_count() + k] = Neta(i, {xi[j], eta[k]});
-                }
+    // Смена порядка иерархического элемента. Таблицы функций, общих с предыдущим порядком, копируются из текущей табуляции,
+    // а вычисляются только таблицы добавленных функций. Табуляции на сторонах строятся заново, если они были заданы.
+    template<bool Hierarchical = is_hierarchical_v<Element_Type>>
+    std::enable_if_t<Hierarchical> set_order(const size_t order) {
+        const std::shared_ptr<const tabulation<T>> previous = element_integrate_base<T>::shared_tabulation();
+        element_2d<T, Element_Type>::set_order(order);
+        set_tabulation(element_2d<T, Element_Type>::parameters(), [this, &previous] {
+            const auto [points, weights] = quadrature_points(*_quadrature_xi, *_quadrature_eta);
+            const size_t nodes_count = element_2d<T, Element_Type>::nodes_count(), components = previous->components_count(),
+                         kept = std::min(nodes_count, previous->nodes_count());
+            std::vector<std::vector<T>> tables(components, std::vector<T>(nodes_count * weights.size()));
+            std::array<T*, 6> data = {};
+            for(size_t c = 0; c < components; ++c) {
+                data[c] = tables[c].data();
+                for(size_t i = 0; i < kept; ++i)
+                    for(size_t q = 0; q < weights.size(); ++q)
+                        tables[c][i * weights.size() + q] = (*previous)(c, i, q);
+            }
+            if (kept < nodes_count)
+                element_2d<T, Element_Type>::template tabulate_modes<Eval_T>(points, kept, data[0], data[1], data[2], data[3], data[4], data[5]);
+            return std::make_shared<const tabulation<T>>(layout(), weights, nodes_count, std::vector<const T*>(data.cbegin(), data.cbegin() + components));
+        });
+        if (const std::shared_ptr<const quadrature_1d_base<T>> quadrature = element_2d_integrate_base<T>::edge_quadrature())
+            set_edge_quadrature(*quadrature);
     }
 };
 
@@ -1,6 +1,8 @@
 #ifndef FINITE_ELEMENT_2D_INTEGRATE_BASE_HPP
 #define FINITE_ELEMENT_2D_INTEGRATE_BASE_HPP
 
+#include <cmath>
+#include <memory>
 #include "element_integrate_base.hpp"
 #include "element_2d_base.hpp"
 #include "quadrature.hpp"
@@ -10,8 +12,67 @@ namespace metamath::finite_element {
 template<class T>
 class element_2d_integrate_base : public element_integrate_base<T>,
                                   public virtual element_2d_base<T> {
+    // Табуляция на стороне элемента: значения функций формы и их производных в узлах одномерной квадратуры,
+    // отображённых на сторону. Веса включают якобиан стороны, поэтому сумма весов равна длине стороны.
+    struct edge final {
+        tabulation_key<T> key = {typeid(void), {}, {}, table_layout::NODE_MAJOR};
+        std::shared_ptr<const tabulation<T>> table = nullptr;
+        std::array<std::array<T, 2>, 2> ends = {};
+        std::array<T, 2> normal = {};
+        T jacobian = T{0};
+    };
+
+    std::array<edge, 4> _edges;
+
 protected:
-    std::vector<T> _qNxi, _qNeta;
+    std::shared_ptr<const quadrature_1d_base<T>> _quadrature_xi = nullptr, _quadrature_eta = nullptr;
+    std::shared_ptr<const quadrature_1d_base<T>> _edge_quadrature = nullptr;
+
+    // Концы стороны bound. Стороны считаются прямолинейными, что верно для треугольной и прямоугольной геометрий.
+    std::array<std::array<T, 2>, 2> edge_ends(const side_2d bound) const {
+        const T left = boundary(side_2d::LEFT, 0), right = boundary(side_2d::RIGHT, 0);
+        switch(bound) {
+            case side_2d::LEFT:  return {{ {left,  boundary(side_2d::DOWN, left )}, {left,  boundary(side_2d::UP,   left )} }};
+            case side_2d::RIGHT: return {{ {right, boundary(side_2d::DOWN, right)}, {right, boundary(side_2d::UP,   right)} }};
+            case side_2d::DOWN:  return {{ {left,  boundary(side_2d::DOWN, left )}, {right, boundary(side_2d::DOWN, right)} }};
+            case side_2d::UP:    return {{ {left,  boundary(side_2d::UP,   left )}, {right, boundary(side_2d::UP,   right)} }};
+        }
+        return {};
+    }
+
+    // Табуляции на всех сторонах элемента. Tabulate по точкам и весам строит табуляцию в размещении layout().
+    // Табуляции разделяются через реестр и кэш так же, как табуляции внутри элемента.
+    template<class Tabulate>
+    void set_edge_tabulations(const std::type_index element, const quadrature_1d_base<T>& quadrature, const std::vector<T>& parameters,
+                              const Tabulate& tabulate) {
+        _edge_quadrature = shared_registry<std::type_index, quadrature_1d_base<T>>::instance().get(typeid(quadrature), [&quadrature] {
+            return std::shared_ptr<const quadrature_1d_base<T>>{quadrature.clone()};
+        });
+        const T length = quadrature.boundary(side_1d::RIGHT) - quadrature.boundary(side_1d::LEFT);
+        for(const side_2d bound : {side_2d::LEFT, side_2d::RIGHT, side_2d::DOWN, side_2d::UP}) {
+            edge& current = _edges[size_t(bound)];
+            current.ends = edge_ends(bound);
+            const std::array<T, 2> tangent = {current.ends[1][0] - current.ends[0][0], current.ends[1][1] - current.ends[0][1]};
+            const T edge_length = std::hypot(tangent[0], tangent[1]);
+            current.jacobian = edge_length / length;
+            // Внешняя нормаль: стороны LEFT и UP обходятся против часовой стрелки, RIGHT и DOWN --- по часовой.
+            const T orientation = bound == side_2d::LEFT || bound == side_2d::UP ? T{-1} : T{1};
+            current.normal = edge_length > T{0} ? std::array<T, 2>{orientation * tangent[1] / edge_length, -orientation * tangent[0] / edge_length} :
+                                                  std::array<T, 2>{};
+            current.key = {element, {typeid(quadrature)}, parameters, element_integrate_base<T>::layout(), false, int8_t(bound)};
+            current.table = element_integrate_base<T>::cached_tabulation(current.key, [&quadrature, &current, length, &tabulate] {
+                std::vector<std::array<T, 2>> points(quadrature.nodes_count());
+                std::vector<T> weights(quadrature.nodes_count());
+                for(size_t q = 0; q < quadrature.nodes_count(); ++q) {
+                    const T s = (quadrature.node(q)[0] - quadrature.boundary(side_1d::LEFT)) / length;
+                    points[q] = {current.ends[0][0] + s * (current.ends[1][0] - current.ends[0][0]),
+                                 current.ends[0][1] + s * (current.ends[1][1] - current.ends[0][1])};
+                    weights[q] = quadrature.weight(q) * current.jacobian;
+                }
+                return tabulate(points, weights);
+            });
+        }
+    }
 
 public:
     using element_integrate_base<T>::nodes_count;
@@ -21,13 +82,86 @@ public:
     using element_2d_base<T>::N;
     using element_2d_base<T>::Nxi;
     using element_2d_base<T>::Neta;
+    using element_2d_base<T>::Nxixi;
+    using element_2d_base<T>::Nxieta;
+    using element_2d_base<T>::Netaeta;
 
     ~element_2d_integrate_base() override = default;
 
     virtual void set_quadrature(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) = 0;
+    const std::shared_ptr<const quadrature_1d_base<T>>& quadrature_xi () const noexcept { return _quadrature_xi;  }
+    const std::shared_ptr<const quadrature_1d_base<T>>& quadrature_eta() const noexcept { return _quadrature_eta; }
+
+    // Смена размещения таблиц, в том числе таблиц на сторонах элемента.
+    void set_layout(const table_layout layout) {
+        element_integrate_base<T>::set_layout(layout);
+        for(edge& current : _edges)
+            if (current.table && current.table->layout() != layout) {
+                current.key.layout = layout;
+                current.table = element_integrate_base<T>::cached_tabulation(current.key, [&current, layout] {
+                    return std::make_shared<const tabulation<T>>(*current.table, layout);
+                });
+            }
+    }
+
+    // Табуляции на сторонах элемента для вычисления интегралов по границе (условия Неймана и Робена, потоки).
+    // Узлы квадратуры отображаются на каждую сторону, веса включают якобиан стороны: sum_q edge_weight(side, q) --- длина стороны.
+    // У вырожденных сторон (например, RIGHT у треугольника) длина, веса и нормаль равны нулю.
+    virtual void set_edge_quadrature(const quadrature_1d_base<T>& quadrature) = 0;
+    const std::shared_ptr<const quadrature_1d_base<T>>& edge_quadrature() const noexcept { return _edge_quadrature; }
+
+    const std::shared_ptr<const tabulation<T>>& edge_tabulation(const side_2d bound) const noexcept { return _edges[size_t(bound)].table; }
+
+    size_t edge_qnodes_count(const side_2d bound) const noexcept {
+        return _edges[size_t(bound)].table ? _edges[size_t(bound)].table->qnodes_count() : 0;
+    }
+
+    T edge_jacobian(const side_2d bound) const noexcept { return _edges[size_t(bound)].jacobian; }
+    const std::array<T, 2>& edge_normal(const side_2d bound) const noexcept { return _edges[size_t(bound)].normal; }
+
+    // Квадратурный узел q на стороне bound в координатах элемента.
+    std::array<T, 2> edge_point(const side_2d bound, const size_t q) const {
+        const edge& current = _edges[size_t(bound)];
+        const T s = (_edge_quadrature->node(q)[0] - _edge_quadrature->boundary(side_1d::LEFT)) /
+                    (_edge_quadrature->boundary(side_1d::RIGHT) - _edge_quadrature->boundary(side_1d::LEFT));
+        return {current.ends[0][0] + s * (current.ends[1][0] - current.ends[0][0]),
+                current.ends[0][1] + s * (current.ends[1][1] - current.ends[0][1])};
+    }
+
+    T edge_weight(const side_2d bound, const size_t q) const noexcept { return _edges[size_t(bound)].table->weight(q); }
+
+    T edge_qN   (const side_2d bound, const size_t i, const size_t q) const noexcept { return (*_edges[size_t(bound)].table)(0, i, q); }
+    T edge_qNxi (const side_2d bound, const size_t i, const size_t q) const noexcept { return (*_edges[size_t(bound)].table)(1, i, q); }
+    T edge_qNeta(const side_2d bound, const size_t i, const size_t q) const noexcept { return (*_edges[size_t(bound)].table)(2, i, q); }
+
+    strided_span<const T> edge_qN_row   (const side_2d bound, const size_t i) const noexcept { return _edges[size_t(bound)].table->row   (0, i); }
+    strided_span<const T> edge_qN_column(const side_2d bound, const size_t q) const noexcept { return _edges[size_t(bound)].table->column(0, q); }
+
+    T qNxi (const size_t i, const size_t q) const noexcept { return element_integrate_base<T>::table(1, i, q); }
+    T qNeta(const size_t i, const size_t q) const noexcept { return element_integrate_base<T>::table(2, i, q); }
+
+    strided_span<const T> qNxi_row    (const size_t i) const noexcept { return element_integrate_base<T>::table_row   (1, i); }
+    strided_span<const T> qNxi_column (const size_t q) const noexcept { return element_integrate_base<T>::table_column(1, q); }
+    strided_span<const T> qNeta_row   (const size_t i) const noexcept { return element_integrate_base<T>::table_row   (2, i); }
+    strided_span<const T> qNeta_column(const size_t q) const noexcept { return element_integrate_base<T>::table_column(2, q); }
+
+    // Таблицы вторых производных доступны, если они были запрошены методом set_second_derivatives до построения таблиц.
+    T qNxixi  (const size_t i, const size_t q) const noexcept { return element_integrate_base<T>::table(3, i, q); }
+    T qNxieta (const size_t i, const size_t q) const noexcept { return element_integrate_base<T>::table(4, i, q); }
+    T qNetaeta(const size_t i, const size_t q) const noexcept { return element_integrate_base<T>::table(5, i, q); }
+
+    strided_span<const T> qNxixi_row     (const size_t i) const noexcept { return element_integrate_base<T>::table_row   (3, i); }
+    strided_span<const T> qNxixi_column  (const size_t q) const noexcept { return element_integrate_base<T>::table_column(3, q); }
+    strided_span<const T> qNxieta_row    (const size_t i) const noexcept { return element_integrate_base<T>::table_row   (4, i); }
+    strided_span<const T> qNxieta_column (const size_t q) const noexcept { return element_integrate_base<T>::table_column(4, q); }
+    strided_span<const T> qNetaeta_row   (const size_t i) const noexcept { return element_integrate_base<T>::table_row   (5, i); }
+    strided_span<const T> qNetaeta_column(const size_t q) const noexcept { return element_integrate_base<T>::table_column(5, q); }
 
-    T qNxi (const size_t i, const size_t q) const noexcept { return _qNxi [i*qnodes_count() + q]; }
-    T qNeta(const size_t i, const size_t q) const noexcept { return _qNeta[i*qnodes_count() + q]; }
+    // Матрицы эталонного элемента: масса, блоки жёсткости K^{xi xi}, K^{xi eta}, K^{eta eta} и конвекции по xi и eta,
+    // вычисленные по текущим таблицам. Для аффинных элементов матрицы элемента получаются их линейной комбинацией.
+    std::shared_ptr<const reference_matrices<T>> shared_reference_matrices() const {
+        return element_integrate_base<T>::shared_reference_matrices(2);
+    }
 };
 
 }
@@ -0,0 +1,88 @@
+#ifndef FINITE_ELEMENT_2D_NODAL_HPP
+#define FINITE_ELEMENT_2D_NODAL_HPP
+
+#include "element_2d.hpp"
+#include "nodal_basis.hpp"
+#include "basis/nodal_qubic_triangle.hpp"
+#include "basis/nodal_qubic_serendipity.hpp"
+#include "basis/nodal_quartic_serendipity.hpp"
+#include "basis/nodal_quintic_serendipity.hpp"
+
+namespace metamath::finite_element {
+
+// Элементы, функции формы которых строятся во время выполнения программы по узлам и пространству одночленов.
+template<class T, template<class> class Element_Type>
+class element_2d_nodal : public virtual element_2d_base<T>,
+                         public nodal_basis<T, Element_Type> {
+    using nodal_base = nodal_basis<T, Element_Type>;
+
+public:
+    static constexpr bool parametric = false;
+
+    ~element_2d_nodal() override = default;
+
+    size_t nodes_count() const override { return Element_Type<T>::nodes.size(); }
+
+    const std::array<T, 2>& node(const size_t i) const override { return Element_Type<T>::nodes[i]; }
+
+    T N   (const size_t i, const std::array<T, 2>& xi) const override { return nodal_base::evaluate(i, xi, 0); }
+    T Nxi (const size_t i, const std::array<T, 2>& xi) const override { return nodal_base::evaluate(i, xi, 1); }
+    T Neta(const size_t i, const std::array<T, 2>& xi) const override { return nodal_base::evaluate(i, xi, 2); }
+
+    T Nxixi  (const size_t i, const std::array<T, 2>& xi) const override { return nodal_base::evaluate(i, xi, 3); }
+    T Nxieta (const size_t i, const std::array<T, 2>& xi) const override { return nodal_base::evaluate(i, xi, 4); }
+    T Netaeta(const size_t i, const std::array<T, 2>& xi) const override { return nodal_base::evaluate(i, xi, 5); }
+
+    T boundary(const side_2d bound, const T x) const override { return Element_Type<T>::boundary(bound, x); }
+
+    void tabulate(const std::vector<std::array<T, 2>>& points, const derivative_2d mask, T* out) const override {
+        const auto block = [&out, mask, size = nodes_count() * points.size()](const derivative_2d flag) {
+            return mask & flag ? std::exchange(out, out + size) : nullptr;
+        };
+        T* const N       = block(derivative_2d::N);
+        T* const Nxi     = block(derivative_2d::XI);
+        T* const Neta    = block(derivative_2d::ETA);
+        T* const Nxixi   = block(derivative_2d::XIXI);
+        T* const Nxieta  = block(derivative_2d::XIETA);
+        T* const Netaeta = block(derivative_2d::ETAETA);
+        tabulate_basis<T>(points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+
+protected:
+    std::vector<T> parameters() const { return {}; }
+
+    // Пакетное вычисление функций формы в типе Eval_T, результат сохраняется в типе T.
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 2>>& points, T* const N, T* const Nxi, T* const Neta,
+                        T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr) const {
+        nodal_basis<Eval_T, Element_Type>::tabulate(points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+};
+
+template<class T>
+class element_2d<T, nodal_qubic_triangle> : public element_2d_nodal<T, nodal_qubic_triangle> {
+public:
+    ~element_2d() override = default;
+};
+
+template<class T>
+class element_2d<T, nodal_qubic_serendipity> : public element_2d_nodal<T, nodal_qubic_serendipity> {
+public:
+    ~element_2d() override = default;
+};
+
+template<class T>
+class element_2d<T, nodal_quartic_serendipity> : public element_2d_nodal<T, nodal_quartic_serendipity> {
+public:
+    ~element_2d() override = default;
+};
+
+template<class T>
+class element_2d<T, nodal_quintic_serendipity> : public element_2d_nodal<T, nodal_quintic_serendipity> {
+public:
+    ~element_2d() override = default;
+};
+
+}
+
+#endif
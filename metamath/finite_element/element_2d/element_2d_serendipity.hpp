@@ -12,19 +12,75 @@ class element_2d_serendipity : public virtual element_2d_base<T>,
                                public derivative_element_2d_basis<T, Element_Type, 3> {
     using derivative_base = derivative_element_2d_basis<T, Element_Type, 3>;
     using Element_Type<T>::_p;
+    using Element_Type<T>::p;
 
 public:
+    // Функции формы серендиповых элементов линейно зависят от параметра p.
+    static constexpr bool parametric = true;
+
     ~element_2d_serendipity() override = default;
 
-    size_t nodes_count() const override { return derivative_base::N.size(); }
+    size_t nodes_count() const override { return Element_Type<T>::nodes.size(); }
 
     const std::array<T, 2>& node(const size_t i) const override { return Element_Type<T>::nodes[i]; }
 
-    T N   (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::N   [i]({xi[0], xi[1], _p}); }
-    T Nxi (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::Nxi [i]({xi[0], xi[1], _p}); }
-    T Neta(const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::Neta[i]({xi[0], xi[1], _p}); }
+    T N   (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::functions().N   [i]({xi[0], xi[1], _p}); }
+    T Nxi (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::functions().Nxi [i]({xi[0], xi[1], _p}); }
+    T Neta(const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::functions().Neta[i]({xi[0], xi[1], _p}); }
+
+    T Nxixi  (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::second_derivatives(i, {xi[0], xi[1], _p})[0]; }
+    T Nxieta (const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::second_derivatives(i, {xi[0], xi[1], _p})[1]; }
+    T Netaeta(const size_t i, const std::array<T, 2>& xi) const override { return derivative_base::second_derivatives(i, {xi[0], xi[1], _p})[2]; }
 
     T boundary(const side_2d bound, const T x) const override { return Element_Type<T>::boundary(bound, x); }
+
+    void tabulate(const std::vector<std::array<T, 2>>& points, const derivative_2d mask, T* out) const override {
+        const auto block = [&out, mask, size = nodes_count() * points.size()](const derivative_2d flag) {
+            return mask & flag ? std::exchange(out, out + size) : nullptr;
+        };
+        T* const N       = block(derivative_2d::N);
+        T* const Nxi     = block(derivative_2d::XI);
+        T* const Neta    = block(derivative_2d::ETA);
+        T* const Nxixi   = block(derivative_2d::XIXI);
+        T* const Nxieta  = block(derivative_2d::XIETA);
+        T* const Netaeta = block(derivative_2d::ETAETA);
+        tabulate_basis<T>(points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+    }
+
+protected:
+    std::vector<T> parameters() const { return {_p}; }
+
+    // Пакетное вычисление функций формы в типе Eval_T, результат сохраняется в типе T.
+    // Параметр элемента передаётся в качестве третьей координаты каждой точки.
+    template<class Eval_T>
+    void tabulate_basis(const std::vector<std::array<T, 2>>& points, T* const N, T* const Nxi, T* const Neta,
+                        T* const Nxixi = nullptr, T* const Nxieta = nullptr, T* const Netaeta = nullptr) const {
+        std::vector<std::array<T, 3>> parametrized_points(points.size());
+        for(size_t k = 0; k < points.size(); ++k)
+            parametrized_points[k] = {points[k][0], points[k][1], _p};
+        if (Nxixi || Nxieta || Netaeta)
+            derivative_element_2d_basis<Eval_T, Element_Type, 3>::tabulate(parametrized_points, N, Nxi, Neta, Nxixi, Nxieta, Netaeta);
+        else
+            derivative_element_2d_basis<Eval_T, Element_Type, 3>::tabulate(parametrized_points, N, Nxi, Neta);
+    }
+
+    // Так как функции формы линейны по параметру, их таблицы представимы в виде A + p B,
+    // где A --- значения при p = 0, а B --- производные по параметру, от параметра не зависящие.
+    // Таблицы передаются в порядке N, Nxi, Neta, Nxixi, Nxieta, Netaeta, нулевые указатели пропускаются.
+    template<class Eval_T>
+    void tabulate_affine(const std::vector<std::array<T, 2>>& points, const std::array<T*, 6>& A, const std::array<T*, 6>& B) const {
+        std::vector<std::array<T, 3>> parametrized_points(points.size());
+        for(size_t k = 0; k < points.size(); ++k)
+            parametrized_points[k] = {points[k][0], points[k][1], T{0}};
+        using basis = derivative_element_2d_basis<Eval_T, Element_Type, 3>;
+        if (A[3] || A[4] || A[5] || B[3] || B[4] || B[5]) {
+            basis::tabulate(parametrized_points, A[0], A[1], A[2], A[3], A[4], A[5]);
+            basis::template tabulate_derivative<p>(parametrized_points, B[0], B[1], B[2], B[3], B[4], B[5]);
+        } else {
+            basis::tabulate(parametrized_points, A[0], A[1], A[2]);
+            basis::template tabulate_derivative<p>(parametrized_points, B[0], B[1], B[2]);
+        }
+    }
 };
 
 // Специализация под квадратичные серендиповы элементы
@@ -0,0 +1,229 @@
+#ifndef FINITE_ELEMENT_MATRIX_FREE_OPERATOR_2D_HPP
+#define FINITE_ELEMENT_MATRIX_FREE_OPERATOR_2D_HPP
+
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include "tabulation.hpp"
+#include "reference_matrices.hpp"
+
+namespace metamath::finite_element {
+
+// Безматричный оператор y = (mass M + stiffness K) x на сетке аффинных четырёхугольных элементов-тензорных произведений.
+// Функции формы элемента --- произведения одномерных функций N_i(xi) N_j(eta), заданных одномерной табуляцией (N, Nxi)
+// на квадратуре, например element_1d_integrate<T, lagrange>{quadrature, order}.shared_tabulation().
+// Локальная нумерация узлов элемента лексикографическая: k = i * n + j, где i --- номер по xi, j --- номер по eta.
+// Глобальная матрица не собирается: действие оператора на элементе вычисляется сумм-факторизацией за O(p^3) действий на элемент.
+// Элементы обрабатываются пакетами по Batch штук, внутренние циклы идут по элементам пакета с единичным шагом,
+// поэтому компилятор векторизует их без использования специфичных для платформы инструкций.
+template<class T, size_t Batch = 8>
+class matrix_free_operator_2d final {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+    static_assert(Batch > 0, "The Batch must be positive.");
+
+    static constexpr size_t factors_count = 4; // |det J| и G = |det J| J^{-1} J^{-T}: G_00, G_01, G_11.
+
+    size_t _nodes_count = 0, _qnodes_count = 0, _size = 0, _elements_count = 0;
+    std::vector<T> _N, _Nxi, _weights; // Одномерные таблицы: [i * Q + q].
+    std::vector<size_t> _dofs;         // Глобальные номера узлов элементов: [e * n^2 + k].
+    std::vector<T> _factors;           // Геометрические коэффициенты по пакетам: [(b * factors_count + f) * Batch + lane].
+    T _mass = T{0}, _stiffness = T{1};
+
+    size_t element_nodes_count() const noexcept { return _nodes_count * _nodes_count; }
+    size_t batches_count() const noexcept { return (_elements_count + Batch - 1) / Batch; }
+
+public:
+    // jacobians[e] --- матрица Якоби J = dx/dxi аффинного отображения элемента e, dofs --- глобальные номера его узлов.
+    explicit matrix_free_operator_2d(const tabulation<T>& basis, const size_t size, std::vector<size_t> dofs,
+                                     const std::vector<std::array<std::array<T, 2>, 2>>& jacobians,
+                                     const T mass = T{0}, const T stiffness = T{1})
+        : _nodes_count{basis.nodes_count()}
+        , _qnodes_count{basis.qnodes_count()}
+        , _size{size}
+        , _elements_count{jacobians.size()}
+        , _N(_nodes_count * _qnodes_count)
+        , _Nxi(_nodes_count * _qnodes_count)
+        , _weights(_qnodes_count)
+        , _dofs{std::move(dofs)}
+        , _factors(batches_count() * factors_count * Batch, T{0})
+        , _mass{mass}
+        , _stiffness{stiffness} {
+        if (basis.components_count() < 2)
+            throw std::domain_error{"The basis tabulation must contain the first derivatives."};
+        if (_dofs.size() != _elements_count * element_nodes_count())
+            throw std::domain_error{"The dofs size does not match the elements count."};
+        for(const size_t dof : _dofs)
+            if (dof >= _size)
+                throw std::out_of_range{"The dof index is out of the vector range."};
+
+        for(size_t q = 0; q < _qnodes_count; ++q)
+            _weights[q] = basis.weight(q);
+        for(size_t i = 0; i < _nodes_count; ++i)
+            for(size_t q = 0; q < _qnodes_count; ++q) {
+                _N  [i * _qnodes_count + q] = basis(0, i, q);
+                _Nxi[i * _qnodes_count + q] = basis(1, i, q);
+            }
+
+        for(size_t e = 0; e < _elements_count; ++e) {
+            const std::array<T, 3> G = reference_matrices<T>::stiffness_factors(jacobians[e]);
+            const std::array<T, factors_count> factors = {std::abs(jacobian_determinant(jacobians[e])), G[0], G[1], G[2]};
+            for(size_t f = 0; f < factors_count; ++f)
+                _factors[((e / Batch) * factors_count + f) * Batch + e % Batch] = factors[f];
+        }
+    }
+
+    size_t size() const noexcept { return _size; }
+    size_t elements_count() const noexcept { return _elements_count; }
+
+    T mass() const noexcept { return _mass; }
+    T stiffness() const noexcept { return _stiffness; }
+
+    // Размер рабочего массива, необходимого функции apply: значения пакета в узлах, две промежуточные свёртки и три потока в квадратурных узлах.
+    size_t workspace_size() const noexcept {
+        const size_t n = _nodes_count, Q = _qnodes_count;
+        return (n * n + 2 * n * Q + 3 * Q * Q) * Batch;
+    }
+
+    // y = A x. Векторы x и y не должны пересекаться. Рабочий массив workspace размера workspace_size() предоставляет вызывающий,
+    // поэтому многократное применение оператора в итерационных методах не выделяет память.
+    void apply(const T* const x, T* const y, T* const workspace) const {
+        const size_t n = _nodes_count, Q = _qnodes_count;
+        T* const U  = workspace;
+        T* const A0 = U  + n * n * Batch;
+        T* const A1 = A0 + n * Q * Batch;
+        T* const F  = A1 + n * Q * Batch;
+        T* const G  = F  + Q * Q * Batch;
+        T* const H  = G  + Q * Q * Batch;
+        for(size_t k = 0; k < _size; ++k)
+            y[k] = T{0};
+
+        for(size_t b = 0; b < batches_count(); ++b) {
+            const size_t first = b * Batch, lanes = std::min(Batch, _elements_count - first);
+            for(size_t k = 0; k < n * n; ++k)
+                for(size_t l = 0; l < Batch; ++l)
+                    U[k * Batch + l] = l < lanes ? x[_dofs[(first + l) * n * n + k]] : T{0};
+
+            // Интерполяция: свёртка по eta, затем по xi.
+            for(size_t i = 0; i < n; ++i)
+                for(size_t qy = 0; qy < Q; ++qy) {
+                    T* const a0 = &A0[(i * Q + qy) * Batch];
+                    T* const a1 = &A1[(i * Q + qy) * Batch];
+                    for(size_t l = 0; l < Batch; ++l)
+                        a0[l] = a1[l] = T{0};
+                    for(size_t j = 0; j < n; ++j) {
+                        const T* const u = &U[(i * n + j) * Batch];
+                        const T N = _N[j * Q + qy], Nxi = _Nxi[j * Q + qy];
+                        for(size_t l = 0; l < Batch; ++l) {
+                            a0[l] += N   * u[l];
+                            a1[l] += Nxi * u[l];
+                        }
+                    }
+                }
+
+            const T* const det = &_factors[(b * factors_count + 0) * Batch];
+            const T* const g00 = &_factors[(b * factors_count + 1) * Batch];
+            const T* const g01 = &_factors[(b * factors_count + 2) * Batch];
+            const T* const g11 = &_factors[(b * factors_count + 3) * Batch];
+            for(size_t qx = 0; qx < Q; ++qx)
+                for(size_t qy = 0; qy < Q; ++qy) {
+                    std::array<T, Batch> u = {}, u_xi = {}, u_eta = {};
+                    for(size_t i = 0; i < n; ++i) {
+                        const T* const a0 = &A0[(i * Q + qy) * Batch];
+                        const T* const a1 = &A1[(i * Q + qy) * Batch];
+                        const T N = _N[i * Q + qx], Nxi = _Nxi[i * Q + qx];
+                        for(size_t l = 0; l < Batch; ++l) {
+                            u    [l] += N   * a0[l];
+                            u_xi [l] += Nxi * a0[l];
+                            u_eta[l] += N   * a1[l];
+                        }
+                    }
+                    // Значения в квадратурных узлах умножаются на веса и геометрические коэффициенты.
+                    const T w = _weights[qx] * _weights[qy], wm = w * _mass, ws = w * _stiffness;
+                    T* const f = &F[(qx * Q + qy) * Batch];
+                    T* const g = &G[(qx * Q + qy) * Batch];
+                    T* const h = &H[(qx * Q + qy) * Batch];
+                    for(size_t l = 0; l < Batch; ++l) {
+                        f[l] = wm * det[l] * u[l];
+                        g[l] = ws * (g00[l] * u_xi[l] + g01[l] * u_eta[l]);
+                        h[l] = ws * (g01[l] * u_xi[l] + g11[l] * u_eta[l]);
+                    }
+                }
+
+            // Интегрирование с функциями формы: свёртка по xi, затем по eta.
+            for(size_t i = 0; i < n; ++i)
+                for(size_t qy = 0; qy < Q; ++qy) {
+                    T* const a0 = &A0[(i * Q + qy) * Batch];
+                    T* const a1 = &A1[(i * Q + qy) * Batch];
+                    for(size_t l = 0; l < Batch; ++l)
+                        a0[l] = a1[l] = T{0};
+                    for(size_t qx = 0; qx < Q; ++qx) {
+                        const T* const f = &F[(qx * Q + qy) * Batch];
+                        const T* const g = &G[(qx * Q + qy) * Batch];
+                        const T* const h = &H[(qx * Q + qy) * Batch];
+                        const T N = _N[i * Q + qx], Nxi = _Nxi[i * Q + qx];
+                        for(size_t l = 0; l < Batch; ++l) {
+                            a0[l] += N * f[l] + Nxi * g[l];
+                            a1[l] += N * h[l];
+                        }
+                    }
+                }
+
+            for(size_t i = 0; i < n; ++i)
+                for(size_t j = 0; j < n; ++j) {
+                    T* const r = &U[(i * n + j) * Batch];
+                    for(size_t l = 0; l < Batch; ++l)
+                        r[l] = T{0};
+                    for(size_t qy = 0; qy < Q; ++qy) {
+                        const T* const a0 = &A0[(i * Q + qy) * Batch];
+                        const T* const a1 = &A1[(i * Q + qy) * Batch];
+                        const T N = _N[j * Q + qy], Nxi = _Nxi[j * Q + qy];
+                        for(size_t l = 0; l < Batch; ++l)
+                            r[l] += N * a0[l] + Nxi * a1[l];
+                    }
+                }
+
+            for(size_t l = 0; l < lanes; ++l)
+                for(size_t k = 0; k < n * n; ++k)
+                    y[_dofs[(first + l) * n * n + k]] += U[k * Batch + l];
+        }
+    }
+
+    // Рабочий массив увеличивается только при необходимости, поэтому повторные вызовы с тем же workspace не выделяют память.
+    void operator()(const std::vector<T>& x, std::vector<T>& y, std::vector<T>& workspace) const {
+        if (x.size() != _size)
+            throw std::domain_error{"The vector size does not match the operator size."};
+        y.resize(_size);
+        if (workspace.size() < workspace_size())
+            workspace.resize(workspace_size());
+        apply(x.data(), y.data(), workspace.data());
+    }
+
+    // Диагональ оператора, например для предобусловливателя Якоби. Вычисляется через одномерные матрицы
+    // M_ii = sum_q w_q N_i^2, K_ii = sum_q w_q Nxi_i^2 и C_ii = sum_q w_q N_i Nxi_i.
+    std::vector<T> diagonal() const {
+        const size_t n = _nodes_count, Q = _qnodes_count;
+        std::vector<T> M(n), K(n), C(n), result(_size, T{0});
+        for(size_t i = 0; i < n; ++i)
+            for(size_t q = 0; q < Q; ++q) {
+                M[i] += _weights[q] * _N  [i * Q + q] * _N  [i * Q + q];
+                K[i] += _weights[q] * _Nxi[i * Q + q] * _Nxi[i * Q + q];
+                C[i] += _weights[q] * _N  [i * Q + q] * _Nxi[i * Q + q];
+            }
+        for(size_t e = 0; e < _elements_count; ++e) {
+            const T* const factors = &_factors[(e / Batch) * factors_count * Batch + e % Batch];
+            const T det = factors[0], g00 = factors[Batch], g01 = factors[2 * Batch], g11 = factors[3 * Batch];
+            for(size_t i = 0; i < n; ++i)
+                for(size_t j = 0; j < n; ++j)
+                    result[_dofs[e * n * n + i * n + j]] += _mass * det * M[i] * M[j] +
+                        _stiffness * (g00 * K[i] * M[j] + T{2} * g01 * C[i] * C[j] + g11 * M[i] * K[j]);
+        }
+        return result;
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef FINITE_ELEMENT_2D_NODAL_BASIS_HPP
+#define FINITE_ELEMENT_2D_NODAL_BASIS_HPP
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include "initialization_profile.hpp"
+
+namespace metamath::finite_element {
+
+// Узловой базис, коэффициенты которого вычисляются во время выполнения программы.
+// Класс стратегии Element_Type содержит узлы nodes и пространство одночленов monomials, заданных парами степеней (a, b): xi^a eta^b.
+// Функции формы N_i = sum_j C_ij xi^a_j eta^b_j находятся из условия N_i(x_k) = delta_ik, т.е. обращением матрицы Вандермонда V_kj = m_j(x_k).
+// В отличие от символьных базисов, стоимость компиляции не зависит от порядка элемента.
+template<class T, template<class> class Element_Type>
+class nodal_basis : public Element_Type<T> {
+    using Element_Type<T>::nodes;
+    using Element_Type<T>::monomials;
+
+    static_assert(nodes.size() == monomials.size(), "The number of monomials and nodes does not match.");
+
+    static constexpr size_t size = nodes.size();
+
+    static constexpr size_t degree() noexcept {
+        size_t result = 0;
+        for(const auto& monomial : monomials)
+            result = std::max({result, size_t(monomial[0]), size_t(monomial[1])});
+        return result;
+    }
+
+    // Обращение матрицы Вандермонда методом Гаусса-Жордана с выбором главного элемента.
+    // Вычисления проводятся в long double, чтобы коэффициенты в типе T не зависели от обусловленности матрицы.
+    static std::array<T, size * size> coefficients_init() {
+        std::array<std::array<long double, 2 * size>, size> system = {};
+        for(size_t k = 0; k < size; ++k) {
+            for(size_t j = 0; j < size; ++j)
+                system[k][j] = std::pow(static_cast<long double>(nodes[k][0]), monomials[j][0]) *
+                               std::pow(static_cast<long double>(nodes[k][1]), monomials[j][1]);
+            system[k][size + k] = 1;
+        }
+
+        for(size_t j = 0; j < size; ++j) {
+            const size_t pivot = std::max_element(system.begin() + j, system.end(), [j](const auto& lhs, const auto& rhs) {
+                return std::abs(lhs[j]) < std::abs(rhs[j]);
+            }) - system.begin();
+            if (std::abs(system[pivot][j]) < 1e-12l)
+                throw std::domain_error{"The nodes are not unisolvent for the monomial space in nodal_basis."};
+            std::swap(system[j], system[pivot]);
+            const long double diagonal = system[j][j];
+            for(long double& value : system[j])
+                value /= diagonal;
+            for(size_t k = 0; k < size; ++k)
+                if (k != j && system[k][j] != 0) {
+                    const long double factor = system[k][j];
+                    for(size_t l = j; l < 2 * size; ++l)
+                        system[k][l] -= factor * system[j][l];
+                }
+        }
+
+        // C_ij = (V^{-1})_ji
+        std::array<T, size * size> coefficients;
+        for(size_t i = 0; i < size; ++i)
+            for(size_t j = 0; j < size; ++j)
+                coefficients[i * size + j] = static_cast<T>(system[j][size + i]);
+        return coefficients;
+    }
+
+    // Значения одночленов и их производных в порядке m, mxi, meta, mxixi, mxieta, metaeta.
+    using monomials_table = std::array<std::array<T, size>, 6>;
+
+    template<class U>
+    static void monomials_values(const std::array<U, 2>& point, monomials_table& values) {
+        std::array<T, degree() + 1> xi_powers, eta_powers;
+        xi_powers[0] = eta_powers[0] = T{1};
+        for(size_t d = 1; d <= degree(); ++d) {
+            xi_powers [d] = xi_powers [d-1] * static_cast<T>(point[0]);
+            eta_powers[d] = eta_powers[d-1] * static_cast<T>(point[1]);
+        }
+        for(size_t j = 0; j < size; ++j) {
+            const size_t a = monomials[j][0], b = monomials[j][1];
+            values[0][j] = xi_powers[a] * eta_powers[b];
+            values[1][j] = a ? T(a) * xi_powers[a-1] * eta_powers[b] : T{0};
+            values[2][j] = b ? T(b) * xi_powers[a] * eta_powers[b-1] : T{0};
+            values[3][j] = a > 1 ? T(a * (a-1)) * xi_powers[a-2] * eta_powers[b] : T{0};
+            values[4][j] = a && b ? T(a * b) * xi_powers[a-1] * eta_powers[b-1] : T{0};
+            values[5][j] = b > 1 ? T(b * (b-1)) * xi_powers[a] * eta_powers[b-2] : T{0};
+        }
+    }
+
+    static T dot(const std::array<T, size * size>& coefficients, const size_t i, const T* const m) {
+        T result = T{0};
+        for(size_t j = 0; j < size; ++j)
+            result += coefficients[i * size + j] * m[j];
+        return result;
+    }
+
+protected:
+    // Коэффициенты вычисляются при первом обращении, потокобезопасно и без блокировок при последующих обращениях.
+    static const std::array<T, size * size>& coefficients() {
+        static const std::array<T, size * size> values = profile_initialization<Element_Type<T>>(coefficients_init);
+        return values;
+    }
+
+    explicit nodal_basis() = default;
+    ~nodal_basis() override = default;
+
+    // Значение i-ой функции формы (derivative = 0) либо её производной в порядке xi, eta, xixi, xieta, etaeta.
+    static T evaluate(const size_t i, const std::array<T, 2>& point, const size_t derivative) {
+        monomials_table values;
+        monomials_values(point, values);
+        return dot(coefficients(), i, values[derivative].data());
+    }
+
+public:
+    // Пакетное вычисление функций формы и их производных в наборе точек.
+    // Одночлены вычисляются для порции точек, после чего таблицы получаются умножением матрицы коэффициентов на матрицу одночленов.
+    // Функции формы вычисляются в типе T, результат сохраняется в типе U по столбцам: N[i*points.size() + k].
+    // Таблицы, для которых передан нулевой указатель, не вычисляются.
+    template<class U>
+    static void tabulate(const std::vector<std::array<U, 2>>& points, U* const N, U* const Nxi, U* const Neta,
+                         U* const Nxixi = nullptr, U* const Nxieta = nullptr, U* const Netaeta = nullptr) {
+        static constexpr size_t block = 64;
+        const std::array<T, size * size>& coefficients = nodal_basis::coefficients();
+        const std::array<U*, 6> tables = {N, Nxi, Neta, Nxixi, Nxieta, Netaeta};
+        std::vector<monomials_table> values(block);
+        for(size_t begin = 0; begin < points.size(); begin += block) {
+            const size_t end = std::min(begin + block, points.size());
+            for(size_t k = begin; k < end; ++k)
+                monomials_values(points[k], values[k-begin]);
+            for(size_t d = 0; d < tables.size(); ++d)
+                if (tables[d])
+                    for(size_t i = 0; i < size; ++i)
+                        for(size_t k = begin; k < end; ++k)
+                            tables[d][i * points.size() + k] = static_cast<U>(dot(coefficients, i, values[k-begin][d].data()));
+        }
+    }
+};
+
+}
+
+#endif
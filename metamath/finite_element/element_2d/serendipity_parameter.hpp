@@ -0,0 +1,88 @@
+#ifndef FINITE_ELEMENT_2D_SERENDIPITY_PARAMETER_HPP
+#define FINITE_ELEMENT_2D_SERENDIPITY_PARAMETER_HPP
+
+#include <array>
+#include <vector>
+#include <utility>
+#include "derivative.hpp"
+#include "evaluate.hpp"
+#include "quadrature.hpp"
+
+namespace metamath::finite_element {
+
+// Вычисление параметра серендипова элемента, минимизирующего след матрицы жёсткости на стандартном элементе.
+// Функции формы линейны по параметру p, поэтому след матрицы жёсткости tr K(p) = sum_i int (N_i,xi^2 + N_i,eta^2)
+// является квадратичной функцией p, а его минимум находится из условия tr K'(p) = 0: p* = -tr K'(0) / tr K''.
+// Так как N_i,pp = 0, то tr K'(0) = 2 sum_i int (N_i,xi N_i,xip + N_i,eta N_i,etap) и tr K'' = 2 sum_i int (N_i,xip^2 + N_i,etap^2).
+// Производные вычисляются символьно при помощи symdiff для каждой функции формы отдельно, а суммируются численно:
+// символьное дифференцирование всего следа порождает слишком большие выражения для кубического элемента.
+// Интегралы вычисляются квадратурой Quadrature_Type.
+template<class T, template<class> class Element_Type>
+class serendipity_parameter final : Element_Type<T> {
+    using Element_Type<T>::xi;
+    using Element_Type<T>::eta;
+    using Element_Type<T>::p;
+    using Element_Type<T>::basis;
+
+    explicit serendipity_parameter() = default;
+    ~serendipity_parameter() override = default;
+
+    // Вклады функции формы I в tr K'(0) и tr K''.
+    template<size_t I>
+    static std::array<T, 2> trace_derivatives(const std::vector<std::array<T, 3>>& points, const std::vector<T>& weights) {
+        static constexpr auto N = std::get<I>(basis);
+        std::vector<T> values(4 * points.size());
+        symdiff::evaluate<T>(std::make_tuple(symdiff::derivative<xi>(N), symdiff::derivative<eta>(N),
+                                             symdiff::derivative<xi, p>(N), symdiff::derivative<eta, p>(N)), points, values.data());
+        const size_t size = points.size();
+        std::array<T, 2> result = {};
+        for(size_t k = 0; k < size; ++k) {
+            const T Nxi = values[k], Neta = values[size + k], Nxip = values[2 * size + k], Netap = values[3 * size + k];
+            result[0] += T{2} * weights[k] * (Nxi * Nxip + Neta * Netap);
+            result[1] += T{2} * weights[k] * (Nxip * Nxip + Netap * Netap);
+        }
+        return result;
+    }
+
+    template<size_t... I>
+    static std::array<T, 2> trace_derivatives(const std::vector<std::array<T, 3>>& points, const std::vector<T>& weights,
+                                              const std::index_sequence<I...>&) {
+        std::array<T, 2> result = {};
+        const auto add = [&result](const std::array<T, 2>& contribution) {
+            result[0] += contribution[0];
+            result[1] += contribution[1];
+        };
+        (add(trace_derivatives<I>(points, weights)), ...);
+        return result;
+    }
+
+public:
+    // Квадратура должна точно интегрировать квадраты производных функций формы.
+    template<template<class> class Quadrature_Type>
+    static T optimal() {
+        const serendipity_parameter element;
+        const quadrature_1d<T, Quadrature_Type> quadrature;
+        const T jacobian_xi = (element.boundary(side_2d::RIGHT, 0) - element.boundary(side_2d::LEFT, 0)) /
+                              (quadrature.boundary(side_1d::RIGHT) - quadrature.boundary(side_1d::LEFT));
+        std::vector<std::array<T, 3>> points;
+        std::vector<T> weights;
+        for(size_t i = 0; i < quadrature.nodes_count(); ++i) {
+            const T xi = element.boundary(side_2d::LEFT, 0) + (quadrature.node(i)[0] - quadrature.boundary(side_1d::LEFT)) * jacobian_xi;
+            const T down = element.boundary(side_2d::DOWN, xi),
+                    jacobian_eta = (element.boundary(side_2d::UP, xi) - down) /
+                                   (quadrature.boundary(side_1d::RIGHT) - quadrature.boundary(side_1d::LEFT));
+            for(size_t j = 0; j < quadrature.nodes_count(); ++j) {
+                points.push_back({xi, down + (quadrature.node(j)[0] - quadrature.boundary(side_1d::LEFT)) * jacobian_eta, T{0}});
+                weights.push_back(quadrature.weight(i) * jacobian_xi * quadrature.weight(j) * jacobian_eta);
+            }
+        }
+
+        const auto [first, second] = trace_derivatives(points, weights,
+                                                       std::make_index_sequence<std::tuple_size_v<std::decay_t<decltype(basis)>>>{});
+        return -first / second;
+    }
+};
+
+}
+
+#endif
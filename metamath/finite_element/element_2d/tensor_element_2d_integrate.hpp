@@ -0,0 +1,193 @@
+#ifndef FINITE_ELEMENT_TENSOR_ELEMENT_2D_INTEGRATE_HPP
+#define FINITE_ELEMENT_TENSOR_ELEMENT_2D_INTEGRATE_HPP
+
+#include "element_2d.hpp"
+#include "element_1d_integrate.hpp"
+#include "basis/bilinear.hpp"
+#include "basis/quadratic_lagrange.hpp"
+#include "basis/linear.hpp"
+#include "basis/quadratic.hpp"
+
+namespace metamath::finite_element {
+
+// Элементы, функции формы которых являются произведениями одномерных функций формы: N_k(xi, eta) = N_i(xi) N_j(eta).
+// factor --- одномерный элемент, indices[k] = {i, j} --- номера одномерных функций для узла k.
+template<template<class> class Element_Type>
+struct tensor_product {
+    static constexpr bool value = false;
+};
+
+template<>
+struct tensor_product<bilinear> {
+    static constexpr bool value = true;
+
+    template<class T>
+    using factor = linear<T>;
+
+    static constexpr std::array<std::array<size_t, 2>, 4> indices = {{{0, 0}, {1, 0}, {1, 1}, {0, 1}}};
+};
+
+template<>
+struct tensor_product<quadratic_lagrange> {
+    static constexpr bool value = true;
+
+    template<class T>
+    using factor = quadratic<T>;
+
+    static constexpr std::array<std::array<size_t, 2>, 9> indices = {{{0, 0}, {1, 0}, {2, 0}, {2, 1}, {2, 2},
+                                                                      {1, 2}, {0, 2}, {0, 1}, {1, 1}}};
+};
+
+template<template<class> class Element_Type>
+inline constexpr bool is_tensor_product_v = tensor_product<Element_Type>::value;
+
+// Элемент-тензорное произведение, который хранит только одномерные таблицы по xi и по eta, разделяемые через реестр.
+// Объём таблиц O(p Q) вместо O(p^2 Q^2) у element_2d_integrate, поэтому для элементов высоких порядков они помещаются в кэш L1.
+// Значения в узлах двумерной квадратуры вычисляются по требованию произведением одномерных значений,
+// а интерполяция и интегрирование выполняются сумм-факторизацией за O(p Q (p + Q)) действий вместо O(p^2 Q^2).
+// Нумерация квадратурных узлов совпадает с element_2d_integrate: q = q_xi * Q_eta + q_eta.
+template<class T, template<class> class Element_Type>
+class tensor_element_2d_integrate : public element_2d<T, Element_Type> {
+    static_assert(is_tensor_product_v<Element_Type>, "The Element_Type must be a tensor product of 1D elements.");
+
+    using product = tensor_product<Element_Type>;
+
+    std::shared_ptr<const tabulation<T>> _xi = nullptr, _eta = nullptr;
+
+    template<class U>
+    using factor = typename product::template factor<U>;
+
+    static std::shared_ptr<const tabulation<T>> factor_tabulation(const quadrature_1d_base<T>& quadrature) {
+        return element_1d_integrate<T, factor>{quadrature}.shared_tabulation();
+    }
+
+    size_t xi_nodes_count () const noexcept { return _xi ->nodes_count(); }
+    size_t eta_nodes_count() const noexcept { return _eta->nodes_count(); }
+
+public:
+    using element_2d<T, Element_Type>::nodes_count;
+
+    explicit tensor_element_2d_integrate(const quadrature_1d_base<T>& quadrature) {
+        set_quadrature(quadrature, quadrature);
+    }
+
+    explicit tensor_element_2d_integrate(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) {
+        set_quadrature(quadrature_xi, quadrature_eta);
+    }
+
+    ~tensor_element_2d_integrate() override = default;
+
+    void set_quadrature(const quadrature_1d_base<T>& quadrature_xi, const quadrature_1d_base<T>& quadrature_eta) {
+        _xi  = factor_tabulation(quadrature_xi);
+        _eta = factor_tabulation(quadrature_eta);
+    }
+
+    // Одномерные таблицы N и Nxi по каждому направлению.
+    const std::shared_ptr<const tabulation<T>>& xi_tabulation () const noexcept { return _xi;  }
+    const std::shared_ptr<const tabulation<T>>& eta_tabulation() const noexcept { return _eta; }
+
+    size_t xi_qnodes_count () const noexcept { return _xi ->qnodes_count(); }
+    size_t eta_qnodes_count() const noexcept { return _eta->qnodes_count(); }
+    size_t qnodes_count() const noexcept { return xi_qnodes_count() * eta_qnodes_count(); }
+
+    // Количество хранимых значений таблиц, включая веса.
+    size_t tables_size() const noexcept { return _xi->size() + _xi->qnodes_count() + _eta->size() + _eta->qnodes_count(); }
+
+    T weight(const size_t q) const noexcept {
+        return _xi->weight(q / eta_qnodes_count()) * _eta->weight(q % eta_qnodes_count());
+    }
+
+    T qN(const size_t i, const size_t q) const noexcept {
+        const auto [i_xi, i_eta] = product::indices[i];
+        return (*_xi)(0, i_xi, q / eta_qnodes_count()) * (*_eta)(0, i_eta, q % eta_qnodes_count());
+    }
+
+    T qNxi(const size_t i, const size_t q) const noexcept {
+        const auto [i_xi, i_eta] = product::indices[i];
+        return (*_xi)(1, i_xi, q / eta_qnodes_count()) * (*_eta)(0, i_eta, q % eta_qnodes_count());
+    }
+
+    T qNeta(const size_t i, const size_t q) const noexcept {
+        const auto [i_xi, i_eta] = product::indices[i];
+        return (*_xi)(0, i_xi, q / eta_qnodes_count()) * (*_eta)(1, i_eta, q % eta_qnodes_count());
+    }
+
+    // Размер рабочего массива, необходимого функциям interpolate и integrate.
+    size_t workspace_size() const noexcept {
+        return xi_nodes_count() * (eta_nodes_count() + 2 * eta_qnodes_count());
+    }
+
+    // Значения u_h = sum_k u_k N_k и её производных в квадратурных узлах. Нулевые указатели values, dxi, deta пропускаются.
+    // Сначала выполняется свёртка по eta, затем по xi.
+    void interpolate(const T* const u, T* const values, T* const dxi, T* const deta, T* const workspace) const {
+        const size_t nx = xi_nodes_count(), ny = eta_nodes_count(), qx_count = xi_qnodes_count(), qy_count = eta_qnodes_count();
+        T* const U  = workspace;
+        T* const A0 = U  + nx * ny;
+        T* const A1 = A0 + nx * qy_count;
+        for(size_t k = 0; k < nodes_count(); ++k)
+            U[product::indices[k][0] * ny + product::indices[k][1]] = u[k];
+
+        for(size_t i = 0; i < nx; ++i)
+            for(size_t qy = 0; qy < qy_count; ++qy) {
+                T sum0 = T{0}, sum1 = T{0};
+                for(size_t j = 0; j < ny; ++j) {
+                    sum0 += U[i * ny + j] * (*_eta)(0, j, qy);
+                    sum1 += U[i * ny + j] * (*_eta)(1, j, qy);
+                }
+                A0[i * qy_count + qy] = sum0;
+                A1[i * qy_count + qy] = sum1;
+            }
+
+        for(size_t qx = 0; qx < qx_count; ++qx)
+            for(size_t qy = 0; qy < qy_count; ++qy) {
+                T value = T{0}, value_xi = T{0}, value_eta = T{0};
+                for(size_t i = 0; i < nx; ++i) {
+                    value     += (*_xi)(0, i, qx) * A0[i * qy_count + qy];
+                    value_xi  += (*_xi)(1, i, qx) * A0[i * qy_count + qy];
+                    value_eta += (*_xi)(0, i, qx) * A1[i * qy_count + qy];
+                }
+                const size_t q = qx * qy_count + qy;
+                if (values) values[q] = value;
+                if (dxi)    dxi   [q] = value_xi;
+                if (deta)   deta  [q] = value_eta;
+            }
+    }
+
+    // Интегралы r_k = sum_q w_q (f_q N_k + g_q dN_k/dxi + h_q dN_k/deta) --- операция, транспонированная к interpolate.
+    // Нулевые указатели f, g, h означают нулевые величины. Сначала выполняется свёртка по xi, затем по eta.
+    void integrate(const T* const f, const T* const g, const T* const h, T* const result, T* const workspace) const {
+        const size_t nx = xi_nodes_count(), ny = eta_nodes_count(), qx_count = xi_qnodes_count(), qy_count = eta_qnodes_count();
+        T* const R  = workspace;
+        T* const B0 = R  + nx * ny;
+        T* const B1 = B0 + nx * qy_count;
+
+        for(size_t i = 0; i < nx; ++i)
+            for(size_t qy = 0; qy < qy_count; ++qy) {
+                T sum0 = T{0}, sum1 = T{0};
+                for(size_t qx = 0; qx < qx_count; ++qx) {
+                    const size_t q = qx * qy_count + qy;
+                    const T w = _xi->weight(qx) * _eta->weight(qy);
+                    if (f) sum0 += w * f[q] * (*_xi)(0, i, qx);
+                    if (g) sum0 += w * g[q] * (*_xi)(1, i, qx);
+                    if (h) sum1 += w * h[q] * (*_xi)(0, i, qx);
+                }
+                B0[i * qy_count + qy] = sum0;
+                B1[i * qy_count + qy] = sum1;
+            }
+
+        for(size_t i = 0; i < nx; ++i)
+            for(size_t j = 0; j < ny; ++j) {
+                T sum = T{0};
+                for(size_t qy = 0; qy < qy_count; ++qy)
+                    sum += B0[i * qy_count + qy] * (*_eta)(0, j, qy) + B1[i * qy_count + qy] * (*_eta)(1, j, qy);
+                R[i * ny + j] = sum;
+            }
+
+        for(size_t k = 0; k < nodes_count(); ++k)
+            result[k] = R[product::indices[k][0] * ny + product::indices[k][1]];
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,272 @@
+#ifndef FINITE_ELEMENT_WEAK_FORM_HPP
+#define FINITE_ELEMENT_WEAK_FORM_HPP
+
+#include <cmath>
+#include <array>
+#include "symdiff_base.hpp"
+#include "reference_matrices.hpp"
+
+namespace metamath::finite_element {
+
+// Язык слабых постановок на выражениях symdiff. Пробная функция u, тестовая функция v и их градиенты являются листьями выражения,
+// коэффициенты --- числами, например: k * dot(grad(u), grad(v)) + c * u * v или f * v.
+// Степень выражения по u и по v проверяется на этапе компиляции. Билинейная форма с постоянными коэффициентами
+// однозначно задаётся матрицей C_ab при (d_a u)(d_b v), где d_0 --- значение, d_1 и d_2 --- производные по x и y,
+// поэтому выражение вычисляется при создании формы, а ядро сборки работает только с этой матрицей и таблицами элемента.
+namespace weak_form {
+
+template<size_t D>
+struct trial_function : symdiff::expression<trial_function<D>> {
+    template<uintmax_t X>
+    using derivative_type = symdiff::integral_constant<intmax_t, 0>;
+
+    template<class Point>
+    constexpr auto operator()(const Point& point) const { return point.trial[D]; }
+
+    template<uintmax_t X>
+    constexpr derivative_type<X> derivative() const { return derivative_type<X>{}; }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr trial_function substitute(const Tuple&) const { return *this; }
+};
+
+template<size_t D>
+struct test_function : symdiff::expression<test_function<D>> {
+    template<uintmax_t X>
+    using derivative_type = symdiff::integral_constant<intmax_t, 0>;
+
+    template<class Point>
+    constexpr auto operator()(const Point& point) const { return point.test[D]; }
+
+    template<uintmax_t X>
+    constexpr derivative_type<X> derivative() const { return derivative_type<X>{}; }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr test_function substitute(const Tuple&) const { return *this; }
+};
+
+inline constexpr trial_function<0> u;
+inline constexpr test_function<0> v;
+
+template<class X, class Y>
+struct vector_2d final {
+    X x;
+    Y y;
+};
+
+template<template<size_t> class Function>
+constexpr vector_2d<Function<1>, Function<2>> grad(const Function<0>&) { return {}; }
+
+template<class X1, class Y1, class X2, class Y2>
+constexpr auto dot(const vector_2d<X1, Y1>& a, const vector_2d<X2, Y2>& b) { return a.x * b.x + a.y * b.y; }
+
+// Скалярное произведение с постоянным вектором, например для конвективного слагаемого dot(b, grad(u)) * v.
+template<class T, class X, class Y>
+constexpr auto dot(const std::array<T, 2>& a, const vector_2d<X, Y>& b) { return a[0] * b.x + a[1] * b.y; }
+
+template<class T, class X, class Y>
+constexpr auto dot(const vector_2d<X, Y>& a, const std::array<T, 2>& b) { return dot(b, a); }
+
+template<class E>
+inline constexpr bool is_weak_form_term_v = false;
+
+// Степень выражения по пробной и тестовой функциям. Слагаемые суммы должны иметь одинаковую степень.
+// Степень определена только для чисел, пробной и тестовой функций и арифметических операций над ними,
+// поэтому выражения с другими функциями, например sin(u) * v, не компилируются.
+template<class E>
+struct degree {
+    static_assert(is_weak_form_term_v<E>, "The weak form may contain only numbers, the trial and test functions and the operators +, -, *, /.");
+    static constexpr size_t trial = 0, test = 0; // Только чтобы не порождать лишних ошибок после static_assert.
+};
+
+template<class T>
+struct degree<symdiff::constant<T>> {
+    static constexpr size_t trial = 0, test = 0;
+};
+
+template<class T, T N>
+struct degree<symdiff::integral_constant<T, N>> {
+    static constexpr size_t trial = 0, test = 0;
+};
+
+template<size_t D>
+struct degree<trial_function<D>> {
+    static constexpr size_t trial = 1, test = 0;
+};
+
+template<size_t D>
+struct degree<test_function<D>> {
+    static constexpr size_t trial = 0, test = 1;
+};
+
+template<class E>
+struct degree<symdiff::negate<E>> : degree<E> {};
+
+template<class E1, class E2>
+struct degree<symdiff::multiplies<E1, E2>> {
+    static constexpr size_t trial = degree<E1>::trial + degree<E2>::trial,
+                            test  = degree<E1>::test  + degree<E2>::test;
+};
+
+template<class E1, class E2>
+struct degree<symdiff::divides<E1, E2>> : degree<E1> {
+    static_assert(degree<E2>::trial == 0 && degree<E2>::test == 0, "Division by the trial or test function is not a weak form.");
+};
+
+template<class E1, class E2>
+struct degree<symdiff::plus<E1, E2>> : degree<E1> {
+    static_assert(degree<E1>::trial == degree<E2>::trial && degree<E1>::test == degree<E2>::test,
+                  "All terms of the weak form must have the same degree in the trial and test functions.");
+};
+
+template<class E1, class E2>
+struct degree<symdiff::minus<E1, E2>> : degree<symdiff::plus<E1, E2>> {};
+
+template<class T>
+struct point final {
+    std::array<T, 3> trial, test;
+};
+
+// Производные по эталонным координатам (значение, xi, eta) переводятся в производные по x и y матрицей
+// diag(1, J^{-T}) аффинного отображения с матрицей Якоби J = dx/dxi, а объём --- модулем её определителя.
+template<class T>
+std::array<std::array<T, 3>, 3> reference_transform(const std::array<std::array<T, 2>, 2>& jacobian) {
+    const T det = jacobian_determinant(jacobian);
+    return {{{1, 0, 0},
+             {0,  jacobian[1][1] / det, -jacobian[1][0] / det},
+             {0, -jacobian[0][1] / det,  jacobian[0][0] / det}}};
+}
+
+}
+
+// Билинейная форма a(u, v) = int sum_ab C_ab (d_a u)(d_b v) dx. Матрица элемента A_ij = a(N_j, N_i) собирается одним циклом
+// по квадратурным узлам с таблицами статического элемента: сначала вычисляются потоки F_a(i, q) = w_q sum_b C_ab d_b N_i,
+// затем A_ij = sum_q sum_a d_a N_j F_a(i, q). Нулевые строки C пропускаются, а для симметричной C вычисляется только
+// верхний треугольник матрицы элемента.
+template<class T>
+class bilinear_form_2d final {
+    std::array<std::array<T, 3>, 3> _coefficients = {};
+
+    template<class Element>
+    void assemble(const Element& element, const std::array<std::array<T, 3>, 3>& coefficients, const T scale,
+                  std::array<T, Element::nodes_count() * Element::nodes_count()>& matrix) const {
+        constexpr size_t n = Element::nodes_count(), qn = Element::qnodes_count();
+        const std::array<const std::array<T, n * qn>*, 3> tables = {&element.qN(), &element.qNxi(), &element.qNeta()};
+        std::array<bool, 3> active = {};
+        bool symmetric = true;
+        for(size_t a = 0; a < 3; ++a)
+            for(size_t b = 0; b < 3; ++b) {
+                active[a] = active[a] || coefficients[a][b] != T{0};
+                symmetric = symmetric && coefficients[a][b] == coefficients[b][a];
+            }
+
+        std::array<std::array<T, n * qn>, 3> flux = {};
+        for(size_t a = 0; a < 3; ++a)
+            if (active[a])
+                for(size_t b = 0; b < 3; ++b)
+                    if (const T c = scale * coefficients[a][b]; c != T{0})
+                        for(size_t i = 0; i < n; ++i)
+                            for(size_t q = 0; q < qn; ++q)
+                                flux[a][i * qn + q] += c * element.weights()[q] * (*tables[b])[i * qn + q];
+
+        for(size_t i = 0; i < n; ++i)
+            for(size_t j = symmetric ? i : 0; j < n; ++j) {
+                T sum = T{0};
+                for(size_t a = 0; a < 3; ++a)
+                    if (active[a])
+                        for(size_t q = 0; q < qn; ++q)
+                            sum += (*tables[a])[j * qn + q] * flux[a][i * qn + q];
+                matrix[i * n + j] = sum;
+                if (symmetric)
+                    matrix[j * n + i] = sum;
+            }
+    }
+
+public:
+    template<class E>
+    explicit bilinear_form_2d(const symdiff::expression<E>& form) {
+        static_assert(weak_form::degree<E>::trial == 1 && weak_form::degree<E>::test == 1,
+                      "The bilinear form must be linear in both the trial and test functions.");
+        for(size_t a = 0; a < 3; ++a)
+            for(size_t b = 0; b < 3; ++b) {
+                weak_form::point<T> unit = {};
+                unit.trial[a] = unit.test[b] = T{1};
+                _coefficients[a][b] = T(form()(unit));
+            }
+    }
+
+    const std::array<std::array<T, 3>, 3>& coefficients() const noexcept { return _coefficients; }
+
+    // Матрица на эталонном элементе, производные берутся по xi и eta.
+    template<class Element>
+    void assemble(const Element& element, std::array<T, Element::nodes_count() * Element::nodes_count()>& matrix) const {
+        assemble(element, _coefficients, T{1}, matrix);
+    }
+
+    // Матрица аффинного элемента с матрицей Якоби J = dx/dxi: коэффициенты переводятся к эталонным координатам,
+    // C' = P^T C P, где P = diag(1, J^{-T}), поэтому стоимость сборки такая же, как на эталонном элементе.
+    template<class Element>
+    void assemble(const Element& element, const std::array<std::array<T, 2>, 2>& jacobian,
+                  std::array<T, Element::nodes_count() * Element::nodes_count()>& matrix) const {
+        const std::array<std::array<T, 3>, 3> transform = weak_form::reference_transform(jacobian);
+        std::array<std::array<T, 3>, 3> coefficients = {};
+        for(size_t c = 0; c < 3; ++c)
+            for(size_t d = 0; d < 3; ++d)
+                for(size_t a = 0; a < 3; ++a)
+                    for(size_t b = 0; b < 3; ++b)
+                        coefficients[c][d] += transform[a][c] * _coefficients[a][b] * transform[b][d];
+        assemble(element, coefficients, std::abs(jacobian_determinant(jacobian)), matrix);
+    }
+};
+
+// Линейная форма l(v) = int sum_b c_b (d_b v) dx с постоянными коэффициентами, например f * v.
+template<class T>
+class linear_form_2d final {
+    std::array<T, 3> _coefficients = {};
+
+    template<class Element>
+    void assemble(const Element& element, const std::array<T, 3>& coefficients, const T scale,
+                  std::array<T, Element::nodes_count()>& vector) const {
+        constexpr size_t n = Element::nodes_count(), qn = Element::qnodes_count();
+        const std::array<const std::array<T, n * qn>*, 3> tables = {&element.qN(), &element.qNxi(), &element.qNeta()};
+        vector = {};
+        for(size_t b = 0; b < 3; ++b)
+            if (const T c = scale * coefficients[b]; c != T{0})
+                for(size_t i = 0; i < n; ++i)
+                    for(size_t q = 0; q < qn; ++q)
+                        vector[i] += c * element.weights()[q] * (*tables[b])[i * qn + q];
+    }
+
+public:
+    template<class E>
+    explicit linear_form_2d(const symdiff::expression<E>& form) {
+        static_assert(weak_form::degree<E>::trial == 0 && weak_form::degree<E>::test == 1,
+                      "The linear form must be linear in the test function and must not contain the trial function.");
+        for(size_t b = 0; b < 3; ++b) {
+            weak_form::point<T> unit = {};
+            unit.test[b] = T{1};
+            _coefficients[b] = T(form()(unit));
+        }
+    }
+
+    const std::array<T, 3>& coefficients() const noexcept { return _coefficients; }
+
+    template<class Element>
+    void assemble(const Element& element, std::array<T, Element::nodes_count()>& vector) const {
+        assemble(element, _coefficients, T{1}, vector);
+    }
+
+    template<class Element>
+    void assemble(const Element& element, const std::array<std::array<T, 2>, 2>& jacobian, std::array<T, Element::nodes_count()>& vector) const {
+        const std::array<std::array<T, 3>, 3> transform = weak_form::reference_transform(jacobian);
+        std::array<T, 3> coefficients = {};
+        for(size_t d = 0; d < 3; ++d)
+            for(size_t b = 0; b < 3; ++b)
+                coefficients[d] += _coefficients[b] * transform[b][d];
+        assemble(element, coefficients, std::abs(jacobian_determinant(jacobian)), vector);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef FINITE_ELEMENT_ALIGNED_ALLOCATOR_HPP
+#define FINITE_ELEMENT_ALIGNED_ALLOCATOR_HPP
+
+#include <new>
+#include <cstddef>
+
+namespace metamath::finite_element {
+
+// Аллокатор, выравнивающий начало выделенной памяти по границе Alignment байт.
+// Используется для таблиц, строки которых обрабатываются векторными инструкциями.
+template<class T, size_t Alignment>
+class aligned_allocator {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "The Alignment must be a power of two.");
+
+public:
+    using value_type = T;
+
+    template<class U>
+    struct rebind { using other = aligned_allocator<U, Alignment>; };
+
+    constexpr aligned_allocator() noexcept = default;
+
+    template<class U>
+    constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* const p, const size_t) noexcept {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    template<class U>
+    constexpr bool operator==(const aligned_allocator<U, Alignment>&) const noexcept { return true; }
+
+    template<class U>
+    constexpr bool operator!=(const aligned_allocator<U, Alignment>&) const noexcept { return false; }
+};
+
+}
+
+#endif
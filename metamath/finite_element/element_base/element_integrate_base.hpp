@@ -2,28 +2,113 @@
 #define FINITE_ELEMENT_INTEGRATE_BASE_HPP
 
 #include <vector>
+#include <typeindex>
+#include "tabulation.hpp"
+#include "tabulation_cache.hpp"
+#include "reference_matrices.hpp"
+#include "shared_registry.hpp"
 
 namespace metamath::finite_element {
 
+template<class T>
+using tabulation_registry = shared_registry<tabulation_key<T>, tabulation<T>>;
+
+// Матрицы эталонного элемента ссылаются на свою табуляцию, поэтому адрес табуляции однозначно определяет их, пока они существуют.
+template<class T>
+using reference_matrices_registry = shared_registry<const tabulation<T>*, reference_matrices<T>>;
+
 template<class T>
 class element_integrate_base {
     static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
 
+    std::shared_ptr<const tabulation<T>> _tabulation = nullptr;
+    std::shared_ptr<const tabulation_cache<T>> _cache = nullptr;
+    tabulation_key<T> _key = {typeid(void), {}, {}, table_layout::NODE_MAJOR}; // Ключ текущей табуляции.
+    table_layout _layout = table_layout::NODE_MAJOR;
+    bool _second_derivatives = false;
+
 protected:
-    std::vector<T> _weights, _qN;
     explicit element_integrate_base() noexcept = default;
 
+    // Табуляция из реестра. Если её нет в процессе, она загружается из кэша на диске либо строится и сохраняется в него.
+    template<class Factory>
+    std::shared_ptr<const tabulation<T>> cached_tabulation(const tabulation_key<T>& key, const Factory& factory) const {
+        return tabulation_registry<T>::instance().get(key, [this, &key, &factory]() -> std::shared_ptr<const tabulation<T>> {
+            if (!_cache)
+                return factory();
+            if (std::shared_ptr<const tabulation<T>> cached = _cache->load(key))
+                return cached;
+            std::shared_ptr<const tabulation<T>> result = factory();
+            _cache->store(key, *result);
+            return result;
+        });
+    }
+
+    // Получение табуляции из реестра. Factory строит табуляцию в размещении layout(), если её ещё нет,
+    // причём таблицы вторых производных строятся, только если second_derivatives() == true.
+    // Квадратуры идентифицируются своими типами, поэтому типы квадратур не должны иметь состояния.
+    template<class Factory>
+    void set_tabulation(const std::type_index element, std::vector<std::type_index> quadratures, std::vector<T> parameters, const Factory& factory) {
+        _key = {element, std::move(quadratures), std::move(parameters), _layout, _second_derivatives};
+        _tabulation = cached_tabulation(_key, factory);
+    }
+
+    // Аналогично, для тех же элемента, квадратур и набора таблиц, но с другими параметрами.
+    template<class Factory>
+    void set_tabulation(std::vector<T> parameters, const Factory& factory) {
+        _key.parameters = std::move(parameters);
+        _tabulation = cached_tabulation(_key, factory);
+    }
+
+    T table(const size_t c, const size_t i, const size_t q) const noexcept { return (*_tabulation)(c, i, q); }
+
+    strided_span<const T> table_row   (const size_t c, const size_t i) const noexcept { return _tabulation->row   (c, i); }
+    strided_span<const T> table_column(const size_t c, const size_t q) const noexcept { return _tabulation->column(c, q); }
+
+    // Матрицы эталонного элемента для текущей табуляции, разделяемые всеми элементами с той же табуляцией.
+    std::shared_ptr<const reference_matrices<T>> shared_reference_matrices(const size_t dimension) const {
+        return reference_matrices_registry<T>::instance().get(_tabulation.get(), [this, dimension] {
+            return std::make_shared<const reference_matrices<T>>(_tabulation, dimension);
+        });
+    }
+
 public:
     virtual ~element_integrate_base() noexcept = default;
 
-    size_t qnodes_count() const noexcept { return _weights.size(); }
-    size_t  nodes_count() const noexcept { return _qN.size() / qnodes_count(); }
+    size_t qnodes_count() const noexcept { return _tabulation ? _tabulation->qnodes_count() : 0; }
+    size_t  nodes_count() const noexcept { return _tabulation ? _tabulation-> nodes_count() : 0; }
+
+    table_layout layout() const noexcept { return _layout; }
+
+    // Смена размещения таблиц. Уже построенные таблицы переупаковываются без повторного вычисления функций формы.
+    void set_layout(const table_layout layout) {
+        _layout = layout;
+        if (_tabulation && _tabulation->layout() != layout) {
+            _key.layout = layout;
+            _tabulation = cached_tabulation(_key, [this] { return std::make_shared<const tabulation<T>>(*_tabulation, _layout); });
+        }
+    }
+
+    // Таблицы вторых производных строятся только по запросу и хранятся в том же размещении, что и остальные таблицы.
+    // Настройка применяется при следующем построении таблиц, например при вызове set_quadrature.
+    bool second_derivatives() const noexcept { return _second_derivatives; }
+    void set_second_derivatives(const bool enabled) noexcept { _second_derivatives = enabled; }
+
+    // Кэш табуляций на диске, используемый при последующих построениях табуляций, например в set_quadrature.
+    void set_cache(std::shared_ptr<const tabulation_cache<T>> cache) noexcept { _cache = std::move(cache); }
+    const std::shared_ptr<const tabulation_cache<T>>& cache() const noexcept { return _cache; }
+
+    // Табуляция, разделяемая всеми элементами с одинаковыми типом, квадратурами и параметрами.
+    const std::shared_ptr<const tabulation<T>>& shared_tabulation() const noexcept { return _tabulation; }
+
+    T weight(const size_t q) const noexcept { return _tabulation->weight(q); }
 
-    T weight(const size_t q) const noexcept { return _weights[q]; }
+    T qN(const size_t i, const size_t q) const noexcept { return table(0, i, q); }
 
-    T qN(const size_t i, const size_t q) const noexcept { return _qN[i*qnodes_count() + q]; }
+    strided_span<const T> qN_row   (const size_t i) const noexcept { return table_row   (0, i); }
+    strided_span<const T> qN_column(const size_t q) const noexcept { return table_column(0, q); }
 };
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,85 @@
+#ifndef FINITE_ELEMENT_INITIALIZATION_PROFILE_HPP
+#define FINITE_ELEMENT_INITIALIZATION_PROFILE_HPP
+
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <ostream>
+#include <typeinfo>
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace metamath::finite_element {
+
+// Время построения статических таблиц (функций формы, коэффициентов базисов) по типам элементов.
+// Таблицы строятся при первом обращении, поэтому здесь учитывается только то, что действительно использовалось.
+// Замеры выполняются, если определён макрос METAMATH_STARTUP_PROFILING (опция CMake с тем же именем),
+// иначе profile_initialization не добавляет накладных расходов и отчёт остаётся пустым.
+class initialization_profile final {
+    mutable std::mutex _mutex;
+    std::map<std::string, std::chrono::nanoseconds> _durations;
+
+    explicit initialization_profile() = default;
+
+    static std::string name(const std::type_info& type) {
+#if __has_include(<cxxabi.h>)
+        int status = 0;
+        char* const demangled = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+        std::string result = status == 0 ? demangled : type.name();
+        std::free(demangled);
+        return result;
+#else
+        return type.name();
+#endif
+    }
+
+public:
+    initialization_profile(const initialization_profile&) = delete;
+    initialization_profile& operator=(const initialization_profile&) = delete;
+
+    static initialization_profile& instance() {
+        static initialization_profile profile;
+        return profile;
+    }
+
+    void add(const std::type_info& type, const std::chrono::nanoseconds duration) {
+        std::string key = name(type);
+        const std::lock_guard lock{_mutex};
+        _durations[std::move(key)] += duration;
+    }
+
+    std::vector<std::pair<std::string, std::chrono::nanoseconds>> entries() const {
+        const std::lock_guard lock{_mutex};
+        return {_durations.cbegin(), _durations.cend()};
+    }
+
+    void report(std::ostream& out) const {
+        std::chrono::nanoseconds total{0};
+        for(const auto& [type, duration] : entries()) {
+            out << std::chrono::duration<double, std::micro>(duration).count() << " us\t" << type << '\n';
+            total += duration;
+        }
+        out << std::chrono::duration<double, std::micro>(total).count() << " us\ttotal" << std::endl;
+    }
+};
+
+// Вызов factory с замером времени, которое относится к типу Owner.
+template<class Owner, class Factory>
+auto profile_initialization(const Factory& factory) {
+#ifdef METAMATH_STARTUP_PROFILING
+    const auto begin = std::chrono::steady_clock::now();
+    auto result = factory();
+    initialization_profile::instance().add(typeid(Owner), std::chrono::steady_clock::now() - begin);
+    return result;
+#else
+    return factory();
+#endif
+}
+
+}
+
+#endif
@@ -0,0 +1,141 @@
+#ifndef FINITE_ELEMENT_REFERENCE_MATRICES_HPP
+#define FINITE_ELEMENT_REFERENCE_MATRICES_HPP
+
+#include <cmath>
+#include <array>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include "tabulation.hpp"
+
+namespace metamath::finite_element {
+
+// Определитель матрицы Якоби J = dx/dxi двумерного отображения.
+template<class T>
+T jacobian_determinant(const std::array<std::array<T, 2>, 2>& jacobian) noexcept {
+    return jacobian[0][0] * jacobian[1][1] - jacobian[0][1] * jacobian[1][0];
+}
+
+// Матрицы эталонного элемента, построенные по табуляции: масса M_ij = sum_q w_q N_i N_j,
+// блоки жёсткости K^ab_ij = sum_q w_q dN_i/dx_a dN_j/dx_b и блоки конвекции C^a_ij = sum_q w_q N_i dN_j/dx_a.
+// Для аффинных элементов матрица каждого элемента --- линейная комбинация этих матриц с геометрическими коэффициентами,
+// поэтому сборка не требует обхода квадратурных узлов.
+// Симметричные матрицы (M и K^aa) хранятся в упакованном виде: верхний треугольник по строкам, packed_index(i, j, n), i <= j.
+// Несимметричные блоки K^ab (a < b) и C^a хранятся полностью по строкам: [i*n + j], K^ba = (K^ab)^T.
+template<class T>
+class reference_matrices final {
+    std::shared_ptr<const tabulation<T>> _source;
+    size_t _dimension = 0, _nodes_count = 0;
+    std::vector<T> _mass;
+    std::vector<std::vector<T>> _stiffness; // Блоки в порядке (0,0), (0,1), ..., (0,D-1), (1,1), ...
+    std::vector<std::vector<T>> _convection;
+
+    size_t block(const size_t a, const size_t b) const noexcept { return packed_index(a, b, _dimension); }
+
+    T integrate(const size_t c_left, const size_t i, const size_t c_right, const size_t j) const {
+        const strided_span<const T> left = _source->row(c_left, i), right = _source->row(c_right, j);
+        T result = T{0};
+        for(size_t q = 0; q < _source->qnodes_count(); ++q)
+            result += _source->weight(q) * left[q] * right[q];
+        return result;
+    }
+
+public:
+    static constexpr size_t packed_size(const size_t n) noexcept { return n * (n + 1) / 2; }
+    static constexpr size_t packed_index(const size_t i, const size_t j, const size_t n) noexcept {
+        return i <= j ? i * n - i * (i - 1) / 2 + (j - i) : packed_index(j, i, n);
+    }
+
+    // Табуляция содержит величины N, dN/dx_0, ..., dN/dx_{dimension-1}; остальные величины (вторые производные) не используются.
+    explicit reference_matrices(std::shared_ptr<const tabulation<T>> source, const size_t dimension)
+        : _source{std::move(source)}
+        , _dimension{dimension}
+        , _nodes_count{_source->nodes_count()}
+        , _mass(packed_size(_nodes_count))
+        , _stiffness(packed_size(dimension))
+        , _convection(dimension, std::vector<T>(_nodes_count * _nodes_count)) {
+        if (_source->components_count() < dimension + 1)
+            throw std::domain_error{"The tabulation does not contain first derivatives."};
+        const size_t n = _nodes_count;
+        for(size_t i = 0; i < n; ++i)
+            for(size_t j = i; j < n; ++j)
+                _mass[packed_index(i, j, n)] = integrate(0, i, 0, j);
+        for(size_t a = 0; a < dimension; ++a)
+            for(size_t b = a; b < dimension; ++b) {
+                std::vector<T>& current = _stiffness[block(a, b)];
+                if (a == b) {
+                    current.resize(packed_size(n));
+                    for(size_t i = 0; i < n; ++i)
+                        for(size_t j = i; j < n; ++j)
+                            current[packed_index(i, j, n)] = integrate(a + 1, i, a + 1, j);
+                } else {
+                    current.resize(n * n);
+                    for(size_t i = 0; i < n; ++i)
+                        for(size_t j = 0; j < n; ++j)
+                            current[i * n + j] = integrate(a + 1, i, b + 1, j);
+                }
+            }
+        for(size_t a = 0; a < dimension; ++a)
+            for(size_t i = 0; i < n; ++i)
+                for(size_t j = 0; j < n; ++j)
+                    _convection[a][i * n + j] = integrate(0, i, a + 1, j);
+    }
+
+    size_t dimension() const noexcept { return _dimension; }
+    size_t nodes_count() const noexcept { return _nodes_count; }
+
+    const std::vector<T>& mass() const noexcept { return _mass; }
+    const std::vector<T>& stiffness(const size_t a, const size_t b) const noexcept { return _stiffness[a <= b ? block(a, b) : block(b, a)]; }
+    const std::vector<T>& convection(const size_t a) const noexcept { return _convection[a]; }
+
+    // Матрица массы аффинного элемента: factor M, где factor --- модуль определителя матрицы Якоби. Результат упакован.
+    void element_mass(const T factor, T* const packed) const {
+        for(size_t k = 0; k < _mass.size(); ++k)
+            packed[k] = factor * _mass[k];
+    }
+
+    // Матрица жёсткости аффинного элемента: sum_ab G_ab K^ab, где G = |det J| J^{-1} J^{-T} задана упакованно
+    // (в двумерном случае {G_00, G_01, G_11}). Результат упакован.
+    void element_stiffness(const T* const factors, T* const packed) const {
+        const size_t n = _nodes_count;
+        for(size_t k = 0; k < packed_size(n); ++k)
+            packed[k] = T{0};
+        for(size_t a = 0; a < _dimension; ++a)
+            for(size_t b = a; b < _dimension; ++b) {
+                const T factor = factors[block(a, b)];
+                const std::vector<T>& current = _stiffness[block(a, b)];
+                if (a == b)
+                    for(size_t k = 0; k < current.size(); ++k)
+                        packed[k] += factor * current[k];
+                else
+                    for(size_t i = 0; i < n; ++i)
+                        for(size_t j = i; j < n; ++j)
+                            packed[packed_index(i, j, n)] += factor * (current[i * n + j] + current[j * n + i]);
+            }
+    }
+
+    // Матрица конвекции аффинного элемента с постоянным полем скоростей: sum_a beta_a C^a, где beta = |det J| J^{-1} b.
+    // Результат хранится полностью по строкам.
+    void element_convection(const T* const velocity, T* const full) const {
+        const size_t size = _nodes_count * _nodes_count;
+        for(size_t k = 0; k < size; ++k)
+            full[k] = T{0};
+        for(size_t a = 0; a < _dimension; ++a)
+            for(size_t k = 0; k < size; ++k)
+                full[k] += velocity[a] * _convection[a][k];
+    }
+
+    // Геометрические коэффициенты матрицы жёсткости двумерного аффинного элемента с матрицей Якоби J = dx/dxi:
+    // {G_00, G_01, G_11} для G = |det J| J^{-1} J^{-T}.
+    static std::array<T, 3> stiffness_factors(const std::array<std::array<T, 2>, 2>& jacobian) {
+        const T scale = T{1} / std::abs(jacobian_determinant(jacobian));
+        // J^{-1} = adj(J) / det, поэтому |det| J^{-1} J^{-T} = adj(J) adj(J)^T / |det|.
+        return {( jacobian[1][1] * jacobian[1][1] + jacobian[0][1] * jacobian[0][1]) * scale,
+                (-jacobian[1][1] * jacobian[1][0] - jacobian[0][1] * jacobian[0][0]) * scale,
+                ( jacobian[1][0] * jacobian[1][0] + jacobian[0][0] * jacobian[0][0]) * scale};
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef FINITE_ELEMENT_SHARED_REGISTRY_HPP
+#define FINITE_ELEMENT_SHARED_REGISTRY_HPP
+
+#include <map>
+#include <mutex>
+#include <future>
+#include <memory>
+#include <algorithm>
+
+namespace metamath::finite_element {
+
+// Потокобезопасный реестр неизменяемых объектов, разделяемых в пределах процесса.
+// Объект создаётся при первом запросе по ключу и живёт, пока на него существует хотя бы одна ссылка,
+// поэтому тысячи элементов одного типа ссылаются на одни и те же данные.
+template<class Key, class Value>
+class shared_registry final {
+    static constexpr size_t minimal_prune_threshold = 16;
+
+    // Запись реестра: слабая ссылка на объект и, пока объект строится, будущий результат для остальных запросов того же ключа.
+    struct entry final {
+        std::weak_ptr<const Value> value;
+        std::shared_future<std::shared_ptr<const Value>> pending;
+    };
+
+    std::mutex _mutex;
+    std::map<Key, entry> _cache;
+    size_t _prune_threshold = minimal_prune_threshold;
+
+    explicit shared_registry() = default;
+
+    // Удаление записей об уничтоженных объектах. Выполняется, только когда размер реестра достигает порога,
+    // который после очистки удваивается относительно числа оставшихся записей, поэтому в среднем на вставку приходится O(1) проверок.
+    void prune() {
+        if (_cache.size() < _prune_threshold)
+            return;
+        for(auto it = _cache.begin(); it != _cache.end();)
+            it = !it->second.pending.valid() && it->second.value.expired() ? _cache.erase(it) : std::next(it);
+        _prune_threshold = std::max(2 * _cache.size(), minimal_prune_threshold);
+    }
+
+public:
+    shared_registry(const shared_registry&) = delete;
+    shared_registry& operator=(const shared_registry&) = delete;
+
+    static shared_registry& instance() {
+        static shared_registry registry;
+        return registry;
+    }
+
+    // Factory вызывается без блокировки реестра, поэтому построение объектов с разными ключами идёт параллельно,
+    // а factory может сама обращаться к реестру за объектами с другими ключами. Одновременные запросы того же ключа
+    // ждут результата первого, поэтому каждый объект создаётся ровно один раз. Исключение factory передаётся всем ожидающим.
+    template<class Factory>
+    std::shared_ptr<const Value> get(const Key& key, const Factory& factory) {
+        std::unique_lock lock{_mutex};
+        if (const auto it = _cache.find(key); it != _cache.cend()) {
+            if (std::shared_ptr<const Value> value = it->second.value.lock())
+                return value;
+            if (it->second.pending.valid()) {
+                const std::shared_future<std::shared_ptr<const Value>> pending = it->second.pending;
+                lock.unlock();
+                return pending.get();
+            }
+        } else
+            prune();
+
+        std::promise<std::shared_ptr<const Value>> promise;
+        _cache[key] = {{}, promise.get_future().share()};
+        lock.unlock();
+
+        std::shared_ptr<const Value> value;
+        try {
+            value = factory();
+        } catch(...) {
+            lock.lock();
+            _cache.erase(key);
+            lock.unlock();
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+
+        lock.lock();
+        _cache[key] = {value, {}};
+        lock.unlock();
+        promise.set_value(value);
+        return value;
+    }
+
+    size_t size() {
+        const std::lock_guard lock{_mutex};
+        return _cache.size();
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef FINITE_ELEMENT_STATIC_CONDENSATION_HPP
+#define FINITE_ELEMENT_STATIC_CONDENSATION_HPP
+
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace metamath::finite_element {
+
+// Результат статической конденсации одного элемента: матрица S = K_bb - K_bi K_ii^{-1} K_ib и вектор g = f_b - K_bi K_ii^{-1} f_i
+// на граничных узлах, которые собираются в глобальную систему вместо K и f, а также данные для восстановления внутренних узлов:
+// X = K_ii^{-1} K_ib и y = K_ii^{-1} f_i, так что u_i = y - X u_b. Все матрицы хранятся полностью по строкам.
+template<class T>
+struct condensed_element final {
+    std::vector<T> matrix, load;
+    std::vector<T> coupling, interior_load;
+};
+
+// Статическая конденсация внутренних степеней свободы элемента. Внутренние узлы связаны только с узлами своего элемента,
+// поэтому они исключаются из матрицы элемента до сборки, глобальная система строится только на граничных узлах,
+// а значения во внутренних узлах восстанавливаются после её решения поэлементно.
+// Разбиение узлов задаётся один раз для типа элемента, например методом interior_nodes элемента, и используется для всех элементов.
+template<class T>
+class static_condensation final {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+
+    size_t _nodes_count = 0;
+    std::vector<size_t> _boundary, _interior;
+
+public:
+    explicit static_condensation(const size_t nodes_count, std::vector<size_t> interior)
+        : _nodes_count{nodes_count}
+        , _interior{std::move(interior)} {
+        std::vector<bool> is_interior(nodes_count, false);
+        for(const size_t i : _interior) {
+            if (i >= nodes_count)
+                throw std::out_of_range{"The interior node index is out of the element range."};
+            if (is_interior[i])
+                throw std::domain_error{"The interior node indices must be unique."};
+            is_interior[i] = true;
+        }
+        for(size_t i = 0; i < nodes_count; ++i)
+            if (!is_interior[i])
+                _boundary.push_back(i);
+    }
+
+    size_t nodes_count() const noexcept { return _nodes_count; }
+
+    // Локальные номера граничных узлов в порядке строк конденсированной матрицы и номера внутренних узлов.
+    const std::vector<size_t>& boundary() const noexcept { return _boundary; }
+    const std::vector<size_t>& interior() const noexcept { return _interior; }
+
+    // Конденсация матрицы элемента matrix[i * n + j] и вектора нагрузки load[i]. Нулевой указатель load означает нулевую нагрузку.
+    // Блок K_ii обращается методом Гаусса с выбором ведущего элемента по столбцу одновременно для всех правых частей [K_ib | f_i],
+    // поэтому матрица элемента может быть несимметричной.
+    condensed_element<T> condense(const T* const matrix, const T* const load = nullptr) const {
+        const size_t n = _nodes_count, b = _boundary.size(), m = _interior.size(), columns = b + 1;
+        condensed_element<T> result{std::vector<T>(b * b), std::vector<T>(b), std::vector<T>(m * b), std::vector<T>(m)};
+
+        std::vector<T> A(m * m), R(m * columns); // K_ii и правые части [K_ib | f_i].
+        for(size_t r = 0; r < m; ++r) {
+            for(size_t c = 0; c < m; ++c)
+                A[r * m + c] = matrix[_interior[r] * n + _interior[c]];
+            for(size_t c = 0; c < b; ++c)
+                R[r * columns + c] = matrix[_interior[r] * n + _boundary[c]];
+            R[r * columns + b] = load ? load[_interior[r]] : T{0};
+        }
+
+        for(size_t k = 0; k < m; ++k) {
+            size_t pivot = k;
+            for(size_t r = k + 1; r < m; ++r)
+                if (std::abs(A[r * m + k]) > std::abs(A[pivot * m + k]))
+                    pivot = r;
+            if (A[pivot * m + k] == T{0})
+                throw std::domain_error{"The interior block of the element matrix is singular."};
+            if (pivot != k) {
+                std::swap_ranges(A.begin() + k * m, A.begin() + (k + 1) * m, A.begin() + pivot * m);
+                std::swap_ranges(R.begin() + k * columns, R.begin() + (k + 1) * columns, R.begin() + pivot * columns);
+            }
+            for(size_t r = k + 1; r < m; ++r) {
+                const T factor = A[r * m + k] / A[k * m + k];
+                for(size_t c = k; c < m; ++c)
+                    A[r * m + c] -= factor * A[k * m + c];
+                for(size_t c = 0; c < columns; ++c)
+                    R[r * columns + c] -= factor * R[k * columns + c];
+            }
+        }
+        for(size_t k = m; k-- > 0;) {
+            for(size_t r = k + 1; r < m; ++r)
+                for(size_t c = 0; c < columns; ++c)
+                    R[k * columns + c] -= A[k * m + r] * R[r * columns + c];
+            for(size_t c = 0; c < columns; ++c)
+                R[k * columns + c] /= A[k * m + k];
+        }
+
+        for(size_t r = 0; r < m; ++r) {
+            for(size_t c = 0; c < b; ++c)
+                result.coupling[r * b + c] = R[r * columns + c];
+            result.interior_load[r] = R[r * columns + b];
+        }
+        for(size_t r = 0; r < b; ++r) {
+            T value = load ? load[_boundary[r]] : T{0};
+            for(size_t k = 0; k < m; ++k)
+                value -= matrix[_boundary[r] * n + _interior[k]] * result.interior_load[k];
+            result.load[r] = value;
+            for(size_t c = 0; c < b; ++c) {
+                T sum = matrix[_boundary[r] * n + _boundary[c]];
+                for(size_t k = 0; k < m; ++k)
+                    sum -= matrix[_boundary[r] * n + _interior[k]] * result.coupling[k * b + c];
+                result.matrix[r * b + c] = sum;
+            }
+        }
+        return result;
+    }
+
+    // Восстановление решения на элементе: boundary_values[r] --- значения в граничных узлах в порядке boundary(),
+    // values[i] --- значения во всех узлах элемента в локальной нумерации.
+    void recover(const condensed_element<T>& element, const T* const boundary_values, T* const values) const {
+        const size_t b = _boundary.size();
+        for(size_t r = 0; r < b; ++r)
+            values[_boundary[r]] = boundary_values[r];
+        for(size_t k = 0; k < _interior.size(); ++k) {
+            T value = element.interior_load[k];
+            for(size_t c = 0; c < b; ++c)
+                value -= element.coupling[k * b + c] * boundary_values[c];
+            values[_interior[k]] = value;
+        }
+    }
+};
+
+}
+
+#endif
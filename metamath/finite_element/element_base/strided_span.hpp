@@ -0,0 +1,30 @@
+#ifndef FINITE_ELEMENT_STRIDED_SPAN_HPP
+#define FINITE_ELEMENT_STRIDED_SPAN_HPP
+
+#include <cstddef>
+
+namespace metamath::finite_element {
+
+// Невладеющее представление последовательности элементов, расположенных в памяти с постоянным шагом.
+// Позволяет обращаться к строкам и столбцам таблиц независимо от их размещения в памяти.
+template<class T>
+class strided_span {
+    T* _data = nullptr;
+    size_t _size = 0, _stride = 1;
+
+public:
+    constexpr strided_span() noexcept = default;
+    constexpr strided_span(T* const data, const size_t size, const size_t stride = 1) noexcept
+        : _data{data}, _size{size}, _stride{stride} {}
+
+    constexpr T* data() const noexcept { return _data; }
+    constexpr size_t size() const noexcept { return _size; }
+    constexpr size_t stride() const noexcept { return _stride; }
+    constexpr bool contiguous() const noexcept { return _stride == 1; }
+
+    constexpr T& operator[](const size_t k) const noexcept { return _data[k * _stride]; }
+};
+
+}
+
+#endif
@@ -0,0 +1,217 @@
+#ifndef FINITE_ELEMENT_TABULATION_HPP
+#define FINITE_ELEMENT_TABULATION_HPP
+
+#include <tuple>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <typeindex>
+#include <type_traits>
+#include "aligned_allocator.hpp"
+#include "strided_span.hpp"
+
+namespace metamath::finite_element {
+
+// Размещение таблиц функций формы и их производных в квадратурных узлах.
+// NODE_MAJOR       --- строка таблицы соответствует узлу элемента, для каждой величины отдельная таблица;
+// QUADRATURE_MAJOR --- строка таблицы соответствует квадратурному узлу, для каждой величины отдельная таблица;
+// INTERLEAVED      --- строка соответствует узлу элемента и состоит из записей (N, Nxi, ...) в каждом квадратурном узле.
+enum class table_layout : uint8_t { NODE_MAJOR, QUADRATURE_MAJOR, INTERLEAVED };
+
+// Неизменяемый набор квадратурных весов и таблиц значений функций формы и их производных в квадратурных узлах.
+// Одна и та же табуляция может разделяться многими элементами одного типа с одинаковыми квадратурами.
+// Данные либо принадлежат табуляции, либо размещены во внешней памяти (например, в отображённом в память файле),
+// время жизни которой продлевается вместе с табуляцией. Копия табуляции всегда владеет своими данными.
+template<class T>
+class tabulation final {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+
+public:
+    static constexpr size_t alignment = 64; // Каждая строка таблиц выровнена по этой границе и дополнена нулями.
+
+    template<class U>
+    using aligned_vector = std::vector<U, aligned_allocator<U, alignment>>;
+
+private:
+    aligned_vector<T> _weights_storage, _tables_storage; // Пусты, если данные размещены во внешней памяти.
+    std::shared_ptr<const void> _external = nullptr;
+    const T* _weights = nullptr;
+    const T* _tables = nullptr;
+    table_layout _layout = table_layout::NODE_MAJOR;
+    size_t _qnodes_count = 0, _nodes_count = 0, _components_count = 0;
+    size_t _node_stride = 0, _qnode_stride = 0, _component_stride = 0;
+
+    static size_t padded(const size_t count) noexcept {
+        constexpr size_t block = alignment / sizeof(T);
+        return (count + block - 1) / block * block;
+    }
+
+    void set_strides() noexcept {
+        switch(_layout) {
+            case table_layout::NODE_MAJOR:
+                _node_stride = padded(qnodes_count());
+                _qnode_stride = 1;
+                _component_stride = _nodes_count * _node_stride;
+                break;
+            case table_layout::QUADRATURE_MAJOR:
+                _node_stride = 1;
+                _qnode_stride = padded(_nodes_count);
+                _component_stride = qnodes_count() * _qnode_stride;
+                break;
+            case table_layout::INTERLEAVED:
+                _node_stride = padded(qnodes_count() * _components_count);
+                _qnode_stride = _components_count;
+                _component_stride = 1;
+                break;
+        }
+    }
+
+    template<class Source>
+    void pack(const Source& source) {
+        set_strides();
+        _tables_storage.assign(size(), T{0});
+        for(size_t c = 0; c < _components_count; ++c)
+            for(size_t i = 0; i < _nodes_count; ++i)
+                for(size_t q = 0; q < qnodes_count(); ++q)
+                    _tables_storage[c*_component_stride + i*_node_stride + q*_qnode_stride] = source(c, i, q);
+        _tables = _tables_storage.data();
+    }
+
+public:
+    // Таблицы передаются в порядке N, Nxi, Neta, ... и заданы по узлам: table[i*weights.size() + q].
+    explicit tabulation(const table_layout layout, const std::vector<T>& weights, const size_t nodes_count, const std::vector<const T*>& tables)
+        : _weights_storage(weights.cbegin(), weights.cend())
+        , _weights{_weights_storage.data()}
+        , _layout{layout}
+        , _qnodes_count{weights.size()}
+        , _nodes_count{nodes_count}
+        , _components_count{tables.size()} {
+        pack([&tables, qnodes_count = weights.size()](const size_t c, const size_t i, const size_t q) {
+            return tables[c][i*qnodes_count + q];
+        });
+    }
+
+    // Переупаковка существующей табуляции в другое размещение без повторного вычисления функций формы.
+    explicit tabulation(const tabulation& other, const table_layout layout)
+        : _weights_storage(other._weights, other._weights + other._qnodes_count)
+        , _weights{_weights_storage.data()}
+        , _layout{layout}
+        , _qnodes_count{other._qnodes_count}
+        , _nodes_count{other._nodes_count}
+        , _components_count{other._components_count} {
+        pack([&other](const size_t c, const size_t i, const size_t q) { return other(c, i, q); });
+    }
+
+    // Табуляция constant + p linear. Размещения и веса обеих табуляций должны совпадать.
+    // Дополнение строк нулями сохраняется, а вычисление сводится к одному проходу умножения со сложением по всему массиву.
+    explicit tabulation(const tabulation& constant, const tabulation& linear, const T p)
+        : tabulation{constant} {
+        for(size_t k = 0; k < _tables_storage.size(); ++k)
+            _tables_storage[k] += p * linear._tables[k];
+    }
+
+    // Табуляция во внешней памяти, размещённой так же, как data() табуляции с теми же размерами и размещением.
+    // Адреса weights и tables должны быть выровнены по границе alignment, external продлевает время жизни памяти.
+    explicit tabulation(std::shared_ptr<const void> external, const T* const weights, const T* const tables, const table_layout layout,
+                        const size_t qnodes_count, const size_t nodes_count, const size_t components_count)
+        : _external{std::move(external)}
+        , _weights{weights}
+        , _tables{tables}
+        , _layout{layout}
+        , _qnodes_count{qnodes_count}
+        , _nodes_count{nodes_count}
+        , _components_count{components_count} {
+        set_strides();
+    }
+
+    tabulation(const tabulation& other)
+        : _weights_storage(other._weights, other._weights + other._qnodes_count)
+        , _tables_storage(other._tables, other._tables + other.size())
+        , _weights{_weights_storage.data()}
+        , _tables{_tables_storage.data()}
+        , _layout{other._layout}
+        , _qnodes_count{other._qnodes_count}
+        , _nodes_count{other._nodes_count}
+        , _components_count{other._components_count}
+        , _node_stride{other._node_stride}
+        , _qnode_stride{other._qnode_stride}
+        , _component_stride{other._component_stride} {}
+
+    tabulation(tabulation&&) noexcept = default;
+
+    tabulation& operator=(const tabulation&) = delete;
+    tabulation& operator=(tabulation&&) = delete;
+
+    size_t qnodes_count() const noexcept { return _qnodes_count; }
+    size_t  nodes_count() const noexcept { return _nodes_count; }
+    size_t components_count() const noexcept { return _components_count; }
+    table_layout layout() const noexcept { return _layout; }
+
+    // Веса и таблицы целиком вместе с шагами по узлам элемента, квадратурным узлам и величинам.
+    const T* weights() const noexcept { return _weights; }
+    const T* data() const noexcept { return _tables; }
+    size_t size() const noexcept {
+        return _layout == table_layout::INTERLEAVED ? _nodes_count * _node_stride : _components_count * _component_stride;
+    }
+    size_t node_stride() const noexcept { return _node_stride; }
+    size_t qnode_stride() const noexcept { return _qnode_stride; }
+    size_t component_stride() const noexcept { return _component_stride; }
+
+    // Табуляция размещена во внешней памяти.
+    bool external() const noexcept { return _external != nullptr; }
+
+    T weight(const size_t q) const noexcept { return _weights[q]; }
+
+    // Значение величины c для узла i в квадратурном узле q.
+    T operator()(const size_t c, const size_t i, const size_t q) const noexcept {
+        return _tables[c*_component_stride + i*_node_stride + q*_qnode_stride];
+    }
+
+    // Значения величины c для узла i во всех квадратурных узлах.
+    strided_span<const T> row(const size_t c, const size_t i) const noexcept {
+        return {_tables + c*_component_stride + i*_node_stride, qnodes_count(), _qnode_stride};
+    }
+
+    // Значения величины c для всех узлов в квадратурном узле q.
+    strided_span<const T> column(const size_t c, const size_t q) const noexcept {
+        return {_tables + c*_component_stride + q*_qnode_stride, nodes_count(), _node_stride};
+    }
+};
+
+// Ключ, по которому табуляции разделяются между элементами: тип элемента, типы квадратур, параметры элемента, размещение таблиц,
+// наличие таблиц вторых производных и сторона элемента для табуляций на границе (-1 для табуляций внутри элемента).
+template<class T>
+struct tabulation_key final {
+    std::type_index element;
+    std::vector<std::type_index> quadratures;
+    std::vector<T> parameters;
+    table_layout layout;
+    bool second_derivatives = false;
+    int8_t side = -1;
+
+    bool operator<(const tabulation_key& other) const {
+        return std::tie(element, quadratures, parameters, layout, second_derivatives, side) <
+               std::tie(other.element, other.quadratures, other.parameters, other.layout, other.second_derivatives, other.side);
+    }
+};
+
+// Табуляция элемента, функции формы которого линейно зависят от параметра: A + p B.
+// Таблицы для любого значения параметра получаются без повторного вычисления функций формы.
+template<class T>
+class affine_tabulation final {
+    tabulation<T> _constant, _linear;
+
+public:
+    explicit affine_tabulation(tabulation<T> constant, tabulation<T> linear)
+        : _constant{std::move(constant)}
+        , _linear{std::move(linear)} {}
+
+    table_layout layout() const noexcept { return _constant.layout(); }
+
+    tabulation<T> operator()(const T p) const { return tabulation<T>{_constant, _linear, p}; }
+};
+
+}
+
+#endif
@@ -0,0 +1,198 @@
+#ifndef FINITE_ELEMENT_TABULATION_CACHE_HPP
+#define FINITE_ELEMENT_TABULATION_CACHE_HPP
+
+#include <ios>
+#include <array>
+#include <random>
+#include <memory>
+#include <string>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <system_error>
+#include "tabulation.hpp"
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace metamath::finite_element {
+
+// Кэш табуляций на диске. Каждая табуляция хранится в отдельном файле, имя которого получается из ключа.
+// Файл отображается в память только для чтения без копирования, поэтому процессы одного узла разделяют одни и те же страницы.
+// Формат файла: заголовок, описание ключа, веса и таблицы; веса и таблицы начинаются с границы tabulation<T>::alignment
+// и размещены так же, как в памяти. Файлы другой версии формата, другого типа данных или порядка байт игнорируются.
+// Типы элементов и квадратур идентифицируются именами типов, поэтому кэш разделяется программами, собранными одним компилятором.
+// Версия формата не отражает содержимое функций формы: если базис элемента изменился, а имя его типа нет, файлы устаревают незаметно.
+// Поэтому кэш принимает отпечаток fingerprint (например, идентификатор сборки или ревизии кода с базисами), который входит в описание ключа:
+// файлы с другим отпечатком не загружаются. Без отпечатка устаревшие файлы удаляются вручную методом clear.
+template<class T>
+class tabulation_cache final {
+    static constexpr std::array<char, 8> magic = {'M', 'M', 'F', 'E', 'T', 'A', 'B', '\0'};
+    static constexpr uint32_t byte_order = 0x01020304;
+
+    struct header final {
+        std::array<char, 8> magic;
+        uint32_t version;
+        uint32_t byte_order;
+        uint64_t scalar_size;
+        uint64_t layout;
+        uint64_t qnodes_count, nodes_count, components_count;
+        uint64_t key_size, weights_offset, tables_offset, file_size;
+    };
+
+    std::filesystem::path _directory;
+    std::string _fingerprint;
+
+    static uint64_t aligned(const uint64_t offset) noexcept {
+        return (offset + tabulation<T>::alignment - 1) / tabulation<T>::alignment * tabulation<T>::alignment;
+    }
+
+    // Описание ключа в виде строки. Параметры записываются в шестнадцатеричном виде, чтобы не терять точность.
+    std::string describe(const tabulation_key<T>& key) const {
+        std::ostringstream out;
+        out << _fingerprint << ';' << key.element.name();
+        for(const std::type_index& quadrature : key.quadratures)
+            out << ';' << quadrature.name();
+        out << std::hexfloat;
+        for(const T parameter : key.parameters)
+            out << ';' << parameter;
+        out << ';' << size_t(key.layout) << ';' << key.second_derivatives << ';' << int(key.side);
+        return out.str();
+    }
+
+    // Хеш FNV-1a, значение которого не зависит от реализации стандартной библиотеки.
+    static uint64_t hash(const std::string& description) noexcept {
+        uint64_t result = 14695981039346656037ull;
+        for(const char c : description)
+            result = (result ^ uint64_t(static_cast<unsigned char>(c))) * 1099511628211ull;
+        return result;
+    }
+
+    // Содержимое файла, доступное только для чтения. Память освобождается вместе с последней ссылкой.
+    static std::pair<std::shared_ptr<const void>, size_t> map(const std::filesystem::path& path) {
+#if __has_include(<sys/mman.h>)
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0)
+            return {nullptr, 0};
+        struct stat status = {};
+        void* address = MAP_FAILED;
+        if (::fstat(file, &status) == 0 && status.st_size > 0)
+            address = ::mmap(nullptr, size_t(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+        ::close(file);
+        if (address == MAP_FAILED)
+            return {nullptr, 0};
+        const size_t size = size_t(status.st_size);
+        return {std::shared_ptr<const void>{address, [size](const void* const address) { ::munmap(const_cast<void*>(address), size); }}, size};
+#else
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        if (!file)
+            return {nullptr, 0};
+        const size_t size = size_t(file.tellg());
+        auto buffer = std::make_shared<typename tabulation<T>::template aligned_vector<char>>(size);
+        file.seekg(0);
+        if (!file.read(buffer->data(), std::streamsize(size)))
+            return {nullptr, 0};
+        return {std::shared_ptr<const void>{buffer, buffer->data()}, size};
+#endif
+    }
+
+public:
+    static constexpr uint32_t version = 1;
+
+    explicit tabulation_cache(std::filesystem::path directory, std::string fingerprint = {})
+        : _directory{std::move(directory)}
+        , _fingerprint{std::move(fingerprint)} {
+        std::filesystem::create_directories(_directory);
+    }
+
+    const std::filesystem::path& directory() const noexcept { return _directory; }
+    const std::string& fingerprint() const noexcept { return _fingerprint; }
+
+    // Удаление всех файлов кэша в каталоге, в том числе оставшихся от других отпечатков и версий формата.
+    void clear() const {
+        for(const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator{_directory})
+            if (entry.is_regular_file() && (entry.path().extension() == ".tab" || entry.path().extension() == ".tmp"))
+                std::filesystem::remove(entry.path());
+    }
+
+    std::filesystem::path path(const tabulation_key<T>& key) const {
+        std::ostringstream name;
+        name << std::hex << hash(describe(key)) << ".tab";
+        return _directory / name.str();
+    }
+
+    // Табуляция, отображённая в память из файла, либо nullptr, если файла нет или он не соответствует ключу.
+    std::shared_ptr<const tabulation<T>> load(const tabulation_key<T>& key) const {
+        const auto [memory, size] = map(path(key));
+        if (!memory || size < sizeof(header))
+            return nullptr;
+
+        const char* const bytes = static_cast<const char*>(memory.get());
+        header head;
+        std::memcpy(&head, bytes, sizeof(header));
+        const std::string description = describe(key);
+        if (head.magic != magic || head.version != version || head.byte_order != byte_order || head.scalar_size != sizeof(T) ||
+            head.layout != uint64_t(key.layout) || head.file_size != size || head.key_size != description.size() ||
+            head.weights_offset % tabulation<T>::alignment != 0 || head.tables_offset % tabulation<T>::alignment != 0 ||
+            sizeof(header) + head.key_size > size || description.compare(0, description.size(), bytes + sizeof(header), head.key_size) != 0)
+            return nullptr;
+
+        const T* const weights = reinterpret_cast<const T*>(bytes + head.weights_offset);
+        const T* const tables  = reinterpret_cast<const T*>(bytes + head.tables_offset);
+        auto result = std::make_shared<const tabulation<T>>(memory, weights, tables, key.layout,
+                                                            head.qnodes_count, head.nodes_count, head.components_count);
+        if (head.weights_offset + head.qnodes_count * sizeof(T) > head.tables_offset ||
+            head.tables_offset + result->size() * sizeof(T) > size)
+            return nullptr;
+        return result;
+    }
+
+    // Сохранение табуляции. Файл записывается во временный файл и переименовывается, поэтому процессы,
+    // одновременно заполняющие кэш, не видят частично записанных файлов. Возвращает false, если запись не удалась.
+    bool store(const tabulation_key<T>& key, const tabulation<T>& table) const {
+        const std::string description = describe(key);
+        header head = {};
+        head.magic = magic;
+        head.version = version;
+        head.byte_order = byte_order;
+        head.scalar_size = sizeof(T);
+        head.layout = uint64_t(table.layout());
+        head.qnodes_count = table.qnodes_count();
+        head.nodes_count = table.nodes_count();
+        head.components_count = table.components_count();
+        head.key_size = description.size();
+        head.weights_offset = aligned(sizeof(header) + description.size());
+        head.tables_offset = aligned(head.weights_offset + table.qnodes_count() * sizeof(T));
+        head.file_size = head.tables_offset + table.size() * sizeof(T);
+
+        std::string contents(head.file_size, '\0');
+        std::memcpy(contents.data(), &head, sizeof(header));
+        std::memcpy(contents.data() + sizeof(header), description.data(), description.size());
+        std::memcpy(contents.data() + head.weights_offset, table.weights(), table.qnodes_count() * sizeof(T));
+        std::memcpy(contents.data() + head.tables_offset, table.data(), table.size() * sizeof(T));
+
+        const std::filesystem::path target = path(key);
+        std::filesystem::path temporary = target;
+        temporary += '.' + std::to_string(std::random_device{}()) + ".tmp";
+        std::error_code error, ignored;
+        std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+        file.write(contents.data(), std::streamsize(contents.size()));
+        file.close(); // Ошибки сброса буфера на диск проявляются только при закрытии файла.
+        if (!file) {
+            std::filesystem::remove(temporary, ignored);
+            return false;
+        }
+        std::filesystem::rename(temporary, target, error);
+        if (error)
+            std::filesystem::remove(temporary, ignored);
+        return !error;
+    }
+};
+
+}
+
+#endif
@@ -8,12 +8,29 @@
 
 #include "element_base/element_base.hpp"
 #include "element_base/element_integrate_base.hpp"
+#include "element_base/initialization_profile.hpp"
+#include "element_base/tabulation_cache.hpp"
+#include "element_base/reference_matrices.hpp"
+#include "element_base/static_condensation.hpp"
 
+#include "element_1d/element_1d_lagrange.hpp"
+#include "element_1d/element_1d_hierarchical.hpp"
 #include "element_1d/element_1d_integrate.hpp"
+#include "element_1d/static_element_1d_integrate.hpp"
 #include "element_1d/basis/basis.hpp"
 
 #include "element_2d/element_2d_serendipity.hpp"
+#include "element_2d/element_2d_nodal.hpp"
+#include "element_2d/element_2d_hierarchical.hpp"
+#include "element_2d/element_2d_dubiner.hpp"
 #include "element_2d/element_2d_integrate.hpp"
+#include "element_2d/static_element_2d_integrate.hpp"
+#include "element_2d/serendipity_parameter.hpp"
+#include "element_2d/weak_form.hpp"
+#include "element_2d/tensor_element_2d_integrate.hpp"
+#include "element_2d/matrix_free_operator_2d.hpp"
+#include "element_2d/dubiner_triangle_2d_integrate.hpp"
+#include "element_2d/affine_element_2d.hpp"
 #include "element_2d/basis/basis.hpp"
 
 #endif
\ No newline at end of file
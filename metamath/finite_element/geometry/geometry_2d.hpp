@@ -2,7 +2,6 @@
 #define FINITE_ELEMENT_GEOMETRY_2D_HPP
 
 #include <array>
-#include <functional>
 #include "variable.hpp"
 
 namespace metamath::finite_element {
@@ -39,6 +38,7 @@ public:
 
 // Описание классов стратегий Shape_Type<T>.
 // Каждый класс описывающий двумерную геометрию должен содержать в себе статический массив из четырёх функий, который называется boundary.
+// Указатели на функции, в отличие от std::function, допускают инициализацию на этапе компиляции.
 // Каждая функция должна описывать соответствующий предел интегрирования. Естественно такое описание может быть неоднозначным.
 // Под неоднозначностью понимается то, что переменные пределы интегрирования могут быть как снизу-сверху, так и слева-справа.
 // Выбор подходящего варианта описания зависит от удобства пользования.
@@ -50,7 +50,7 @@ public:
 
 protected:
     explicit triangle_element_geometry() = default;
-    static inline const std::array<std::function<T(const T)>, 4>
+    static constexpr std::array<T(*)(const T), 4>
         boundary = { [](const T   ) { return T{0};    },
                      [](const T   ) { return T{1};    },
                      [](const T   ) { return T{0};    },
@@ -64,7 +64,7 @@ public:
 
 protected:
     explicit rectangle_element_geometry() = default;
-    static inline const std::array<std::function<T(const T)>, 4>
+    static constexpr std::array<T(*)(const T), 4>
         boundary = { [](const T) { return T{-1}; },
                      [](const T) { return T{ 1}; },
                      [](const T) { return T{-1}; },
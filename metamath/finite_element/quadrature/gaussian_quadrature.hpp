@@ -1,13 +1,13 @@
 #ifndef GAUSSIAN_QUADRATURE_HPP
 #define GAUSSIAN_QUADRATURE_HPP
 
-#include <cmath>
 #include "geometry_1d.hpp"
 
 namespace metamath::finite_element {
 
 // Наследование квадратур от класса геометрии подразумевает возможность использования нестандартных квадратур,
 // а так же многомерных квадратур, которые не получаются путём декартова произведения одномерных квадратур.
+// Узлы и веса заданы литералами, чтобы они были вычислены на этапе компиляции, а не при запуске программы.
 
 template<class T>
 class gauss1 : public geometry_1d<T, standart_segment_geometry> {
@@ -25,7 +25,9 @@ protected:
     explicit gauss2() noexcept = default;
     ~gauss2() override = default;
 
-    static const inline std::array<std::array<T, 1>, 2> nodes = { T{-1} / std::sqrt(T{3}), T{1} / std::sqrt(T{3}) };
+    // 1 / sqrt(3)
+    static constexpr std::array<std::array<T, 1>, 2>
+        nodes = { T(-0.577350269189625764509148780501957505l), T(0.577350269189625764509148780501957505l) };
     static constexpr std::array<T, 2> weights = { T{1}, T{1} };
 };
 
@@ -35,7 +37,9 @@ protected:
     explicit gauss3() noexcept = default;
     ~gauss3() override = default;
 
-    static const inline std::array<std::array<T, 1>, 3> nodes = { -std::sqrt(T{3}/T{5}), T{0}, std::sqrt(T{3}/T{5}) };
+    // sqrt(3/5)
+    static constexpr std::array<std::array<T, 1>, 3>
+        nodes = { T(-0.774596669241483377035853079956479879l), T{0}, T(0.774596669241483377035853079956479879l) };
     static constexpr std::array<T, 3> weights = { T{5}/T{9}, T{8}/T{9}, T{5}/T{9} };
 };
 
@@ -45,16 +49,17 @@ protected:
     explicit gauss4() noexcept = default;
     ~gauss4() override = default;
 
-    static const inline std::array<std::array<T, 1>, 4>
-        nodes = { -std::sqrt(T{3}/T{7} + T{2}/T{7} * std::sqrt(T{6}/T{5})),
-                  -std::sqrt(T{3}/T{7} - T{2}/T{7} * std::sqrt(T{6}/T{5})),
-                   std::sqrt(T{3}/T{7} - T{2}/T{7} * std::sqrt(T{6}/T{5})),
-                   std::sqrt(T{3}/T{7} + T{2}/T{7} * std::sqrt(T{6}/T{5})) };
-    static const inline std::array<T, 4>
-        weights = { (T{18} - std::sqrt(T{30})) / T{36},
-                    (T{18} + std::sqrt(T{30})) / T{36},
-                    (T{18} + std::sqrt(T{30})) / T{36},
-                    (T{18} - std::sqrt(T{30})) / T{36} };
+    // sqrt(3/7 -+ 2/7 sqrt(6/5)), (18 +- sqrt(30)) / 36
+    static constexpr std::array<std::array<T, 1>, 4>
+        nodes = { T(-0.861136311594052575223946488892809457l),
+                  T(-0.339981043584856264802665759103244664l),
+                  T( 0.339981043584856264802665759103244664l),
+                  T( 0.861136311594052575223946488892809457l) };
+    static constexpr std::array<T, 4>
+        weights = { T(0.347854845137453857373063949221999378l),
+                    T(0.652145154862546142626936050778000574l),
+                    T(0.652145154862546142626936050778000574l),
+                    T(0.347854845137453857373063949221999378l) };
 };
 
 template<class T>
@@ -63,18 +68,19 @@ protected:
     explicit gauss5() noexcept = default;
     ~gauss5() override = default;
 
-    static const inline std::array<std::array<T, 1>, 5>
-        nodes = { T{-1}/T{3} * std::sqrt(T{5} + T{2} * std::sqrt(T{10}/T{7})),
-                  T{-1}/T{3} * std::sqrt(T{5} - T{2} * std::sqrt(T{10}/T{7})),
+    // sqrt(5 -+ 2 sqrt(10/7)) / 3, (322 +- 13 sqrt(70)) / 900
+    static constexpr std::array<std::array<T, 1>, 5>
+        nodes = { T(-0.906179845938663992797626878299393021l),
+                  T(-0.538469310105683091036314420700208735l),
                   T{ 0},
-                  T{ 1}/T{3} * std::sqrt(T{5} - T{2} * std::sqrt(T{10}/T{7})),
-                  T{ 1}/T{3} * std::sqrt(T{5} + T{2} * std::sqrt(T{10}/T{7})) };
-    static const inline std::array<T, 5>
-        weights = { (T{322} - T{13} * std::sqrt(T{70})) / T{900},
-                    (T{322} + T{13} * std::sqrt(T{70})) / T{900},
+                  T( 0.538469310105683091036314420700208735l),
+                  T( 0.906179845938663992797626878299393021l) };
+    static constexpr std::array<T, 5>
+        weights = { T(0.236926885056189087514264040719917380l),
+                    T(0.478628670499366468041291514835638176l),
                     T{128} / T{225},
-                    (T{322} + T{13} * std::sqrt(T{70})) / T{900},
-                    (T{322} - T{13} * std::sqrt(T{70})) / T{900} };
+                    T(0.478628670499366468041291514835638176l),
+                    T(0.236926885056189087514264040719917380l) };
 };
 
 }
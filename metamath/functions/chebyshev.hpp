@@ -1,6 +1,9 @@
 #ifndef METAMATH_FUNCTIONS_CHEBYSHEV_HPP
 #define METAMATH_FUNCTIONS_CHEBYSHEV_HPP
 
+#include <cmath>
+#include <vector>
+#include <algorithm>
 #include <type_traits>
 #include <stdexcept>
 #include "multinomial.hpp"
@@ -55,6 +58,79 @@ constexpr T chebyshev_second_kind(const T x) {
     return _chebyshev::chebyshev_second_kind_term<N, N/2>(x);
 }
 
+// Узлы Чебышёва первого рода на отрезке [-1, 1]: x_j = cos(pi (j + 1/2) / n), j = 0..n-1.
+template<class T>
+std::vector<T> chebyshev_nodes(const size_t n) {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+    const T pi = std::acos(T{-1});
+    std::vector<T> nodes(n);
+    for(size_t j = 0; j < n; ++j)
+        nodes[j] = std::cos(pi * (T(j) + T{0.5}) / T(n));
+    return nodes;
+}
+
+// Коэффициенты интерполяционного ряда Чебышёва sum_k c_k T_k(x) по значениям функции в узлах chebyshev_nodes.
+template<class T>
+std::vector<T> chebyshev_interpolation_coefficients(const std::vector<T>& values) {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+    const T pi = std::acos(T{-1});
+    const size_t n = values.size();
+    std::vector<T> coefficients(n, T{0});
+    for(size_t k = 0; k < n; ++k) {
+        for(size_t j = 0; j < n; ++j)
+            coefficients[k] += values[j] * std::cos(pi * T(k) * (T(j) + T{0.5}) / T(n));
+        coefficients[k] *= (k ? T{2} : T{1}) / T(n);
+    }
+    return coefficients;
+}
+
+// Вычисление ряда Чебышёва первого рода sum_k c_k T_k(x) по схеме Кленшоу.
+template<class T>
+T chebyshev_series(const std::vector<T>& coefficients, const T x) {
+    T b1 = 0, b2 = 0;
+    for(size_t k = coefficients.size(); k-- > 1; ) {
+        const T b = T{2} * x * b1 - b2 + coefficients[k];
+        b2 = b1;
+        b1 = b;
+    }
+    return coefficients.empty() ? T{0} : coefficients[0] + x * b1 - b2;
+}
+
+// Пакетный вариант схемы Кленшоу. Точки обрабатываются блоками, внутри которых рекурсия идёт одновременно
+// для всех точек блока, поэтому внутренние циклы векторизуются. Допускается совпадение массивов x и out.
+template<class T>
+void chebyshev_series(const std::vector<T>& coefficients, const T* const x, const size_t count, T* const out) {
+    static constexpr size_t block_size = 64;
+    T b1[block_size], b2[block_size];
+    for(size_t begin = 0; begin < count; begin += block_size) {
+        const size_t size = std::min(block_size, count - begin);
+        std::fill_n(b1, size, T{0});
+        std::fill_n(b2, size, T{0});
+        for(size_t k = coefficients.size(); k-- > 1; )
+            for(size_t j = 0; j < size; ++j) {
+                const T b = T{2} * x[begin + j] * b1[j] - b2[j] + coefficients[k];
+                b2[j] = b1[j];
+                b1[j] = b;
+            }
+        const T c0 = coefficients.empty() ? T{0} : coefficients[0];
+        for(size_t j = 0; j < size; ++j)
+            out[begin + j] = c0 + x[begin + j] * b1[j] - b2[j];
+    }
+}
+
+// Коэффициенты производной ряда Чебышёва первого рода на отрезке [-1, 1].
+template<class T>
+std::vector<T> chebyshev_series_derivative(const std::vector<T>& coefficients) {
+    if(coefficients.size() < 2)
+        return {T{0}};
+    std::vector<T> derivative(coefficients.size() + 1, T{0});
+    for(size_t k = coefficients.size() - 1; k > 0; --k)
+        derivative[k-1] = derivative[k+1] + T(2 * k) * coefficients[k];
+    derivative[0] /= T{2};
+    derivative.resize(coefficients.size() - 1);
+    return derivative;
+}
+
 }
 
 #endif
\ No newline at end of file
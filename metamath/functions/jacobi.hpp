@@ -0,0 +1,47 @@
+#ifndef METAMATH_FUNCTIONS_JACOBI_HPP
+#define METAMATH_FUNCTIONS_JACOBI_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace metamath::function {
+
+// Многочлены Якоби P_0^{(alpha,beta)}, ..., P_n^{(alpha,beta)} и их первые и вторые производные в точке x.
+// Вычисляются по трёхчленному рекуррентному соотношению
+// 2k (k + alpha + beta) (2k + alpha + beta - 2) P_k = (2k + alpha + beta - 1) ((2k + alpha + beta) (2k + alpha + beta - 2) x + alpha^2 - beta^2) P_{k-1}
+//                                                   - 2 (k + alpha - 1) (k + beta - 1) (2k + alpha + beta) P_{k-2},
+// производные --- дифференцированием этого соотношения, за O(n) действий. Нулевые указатели пропускаются,
+// вторые производные вычисляются только вместе с первыми.
+template<class T>
+void jacobi_values(const size_t n, const T alpha, const T beta, const T x, T* const values,
+                   T* const derivatives = nullptr, T* const second_derivatives = nullptr) {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+    values[0] = T{1};
+    if (derivatives)
+        derivatives[0] = T{0};
+    if (second_derivatives)
+        second_derivatives[0] = T{0};
+    if (n == 0)
+        return;
+    values[1] = (alpha + 1) + (alpha + beta + 2) * (x - 1) / 2;
+    if (derivatives)
+        derivatives[1] = (alpha + beta + 2) / 2;
+    if (second_derivatives)
+        second_derivatives[1] = T{0};
+    for(size_t k = 2; k <= n; ++k) {
+        const T s = T(2*k) + alpha + beta;
+        const T c1 = T(2*k) * (T(k) + alpha + beta) * (s - 2),
+                c2 = (s - 1) * s * (s - 2),
+                c3 = (s - 1) * (alpha * alpha - beta * beta),
+                c4 = 2 * (T(k) + alpha - 1) * (T(k) + beta - 1) * s;
+        values[k] = ((c2 * x + c3) * values[k-1] - c4 * values[k-2]) / c1;
+        if (derivatives)
+            derivatives[k] = (c2 * values[k-1] + (c2 * x + c3) * derivatives[k-1] - c4 * derivatives[k-2]) / c1;
+        if (derivatives && second_derivatives)
+            second_derivatives[k] = (2 * c2 * derivatives[k-1] + (c2 * x + c3) * second_derivatives[k-1] - c4 * second_derivatives[k-2]) / c1;
+    }
+}
+
+}
+
+#endif
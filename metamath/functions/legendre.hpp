@@ -1,6 +1,7 @@
 #ifndef METAMATH_FUNCTIONS_LEGENDRE_HPP
 #define METAMATH_FUNCTIONS_LEGENDRE_HPP
 
+#include <cstddef>
 #include <type_traits>
 #include <stdexcept>
 #include "multinomial.hpp"
@@ -36,6 +37,27 @@ constexpr T legendre(const T x) {
     return _legendre::legendre_term<N, N>(x) / power<N, T>(2);
 }
 
+// Многочлены Лежандра P_0, ..., P_n и их производные в точке x, порядок которых задаётся во время выполнения программы.
+// Вычисляются по рекуррентным соотношениям (k + 1) P_{k+1} = (2k + 1) x P_k - k P_{k-1} и P'_{k+1} = P'_{k-1} + (2k + 1) P_k
+// за O(n) действий. Если derivatives == nullptr, производные не вычисляются.
+template<class T>
+void legendre_values(const size_t n, const T x, T* const values, T* const derivatives = nullptr) {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+    values[0] = T{1};
+    if (derivatives)
+        derivatives[0] = T{0};
+    if (n == 0)
+        return;
+    values[1] = x;
+    if (derivatives)
+        derivatives[1] = T{1};
+    for(size_t k = 1; k < n; ++k) {
+        values[k+1] = (T(2*k + 1) * x * values[k] - T(k) * values[k-1]) / T(k + 1);
+        if (derivatives)
+            derivatives[k+1] = derivatives[k-1] + T(2*k + 1) * values[k];
+    }
+}
+
 }
 
 #endif
\ No newline at end of file
@@ -25,6 +25,11 @@ struct constant : expression<constant<T>> {
     constexpr derivative_type<X> derivative() const {
         return derivative_type<X>{};
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr constant substitute(const Tuple&) const {
+        return *this;
+    }
 };
 
 template<class E>
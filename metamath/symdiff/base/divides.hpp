@@ -55,6 +55,11 @@ public:
     constexpr derivative_type<X> derivative() const {
         return (e1.template derivative<X>() * e2 - e1 * e2.template derivative<X>()) / (e2 * e2);
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return e1.template substitute<Vars...>(r) / e2.template substitute<Vars...>(r);
+    }
 };
 
 template<class E1, class T2>
@@ -31,6 +31,11 @@ struct integral_constant : expression<integral_constant<T, N>> {
     constexpr derivative_type<X> derivative() const {
         return derivative_type<X>{};
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr integral_constant substitute(const Tuple&) const {
+        return *this;
+    }
 };
 
 template<class E>
@@ -35,6 +35,11 @@ public:
     constexpr derivative_type<X> derivative() const {
         return -e.template derivative<X>();
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return -e.template substitute<Vars...>(r);
+    }
 };
 
 template<class T, T N>
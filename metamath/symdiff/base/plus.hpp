@@ -48,6 +48,11 @@ public:
     constexpr derivative_type<X> derivative() const {
         return e1.template derivative<X>() + e2.template derivative<X>();
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return e1.template substitute<Vars...>(r) + e2.template substitute<Vars...>(r);
+    }
 };
 
 template<class T1, T1 N1, class T2, T2 N2>
@@ -1,6 +1,8 @@
 #ifndef SYMDIFF_VARIABLE_HPP
 #define SYMDIFF_VARIABLE_HPP
 
+#include <tuple>
+#include <cstddef>
 #include "integral_constant.hpp"
 
 namespace metamath::symdiff {
@@ -20,9 +22,26 @@ struct variable : expression<variable<N>> {
         return derivative_type<X>{};
     }
 
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        if constexpr (index_of<Vars...>() < sizeof...(Vars))
+            return std::get<index_of<Vars...>()>(r);
+        else
+            return *this;
+    }
+
     constexpr operator uintmax_t() const {
         return N;
     }
+
+private:
+    // Позиция переменной в списке заменяемых переменных. Если переменной в списке нет, то возвращается длина списка.
+    template<uintmax_t... Vars>
+    static constexpr size_t index_of() noexcept {
+        size_t index = 0;
+        (void)((Vars == N ? false : (++index, true)) && ...);
+        return index;
+    }
 };
 
 }
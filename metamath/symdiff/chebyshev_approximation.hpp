@@ -0,0 +1,289 @@
+#ifndef SYMDIFF_CHEBYSHEV_APPROXIMATION_HPP
+#define SYMDIFF_CHEBYSHEV_APPROXIMATION_HPP
+
+#include <array>
+#include <vector>
+#include <stdexcept>
+#include "chebyshev.hpp"
+#include "integral_constant.hpp"
+
+namespace metamath::symdiff {
+
+// Приближение гладкого выражения одной или двух переменных интерполяционным рядом Чебышёва на заданной области.
+// Дорогие выражения (например, законы теплопроводности, построенные из exp, log и sqrt) заменяются коротким полиномом,
+// который вычисляется по схеме Кленшоу. Приближение само является выражением, поэтому его можно дифференцировать
+// и использовать в других выражениях. Вне области приближения значения экстраполируются полиномом.
+
+template<class T, uintmax_t X>
+class chebyshev_approximation : public expression<chebyshev_approximation<T, X>> {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+
+    std::vector<T> _coefficients;
+    std::array<T, 2> _range;
+
+    T to_reference(const T x) const noexcept {
+        return (T{2} * x - _range[0] - _range[1]) / (_range[1] - _range[0]);
+    }
+
+public:
+    template<uintmax_t Y>
+    using derivative_type = std::conditional_t<X == Y, chebyshev_approximation<T, X>, integral_constant<intmax_t, 0>>;
+
+    explicit chebyshev_approximation(const std::vector<T>& coefficients, const std::array<T, 2>& range) :
+        _coefficients{coefficients}, _range{range} {}
+
+    const std::vector<T>& coefficients() const noexcept { return _coefficients; }
+    const std::array<T, 2>& range() const noexcept { return _range; }
+
+    template<class U>
+    T operator()(const U& x) const {
+        return function::chebyshev_series(_coefficients, to_reference(x[X]));
+    }
+
+    // Пакетное вычисление в наборе значений переменной X.
+    void operator()(const std::vector<T>& x, T* const out) const {
+        for(size_t k = 0; k < x.size(); ++k)
+            out[k] = to_reference(x[k]);
+        function::chebyshev_series(_coefficients, out, x.size(), out);
+    }
+
+    template<uintmax_t Y>
+    derivative_type<Y> derivative() const {
+        if constexpr (X == Y) {
+            std::vector<T> coefficients = function::chebyshev_series_derivative(_coefficients);
+            for(T& coefficient : coefficients)
+                coefficient *= T{2} / (_range[1] - _range[0]);
+            return chebyshev_approximation{coefficients, _range};
+        } else
+            return derivative_type<Y>{};
+    }
+
+    template<uintmax_t... Vars, class Tuple>
+    chebyshev_approximation substitute(const Tuple&) const {
+        static_assert(((Vars != X) && ...), "The variable of Chebyshev approximation cannot be substituted.");
+        return *this;
+    }
+};
+
+template<class T, uintmax_t X, uintmax_t Y>
+class chebyshev_approximation_2d : public expression<chebyshev_approximation_2d<T, X, Y>> {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+    static_assert(X != Y, "The variables must be different.");
+
+    std::vector<std::vector<T>> _coefficients; // _coefficients[i][j] --- коэффициент при T_i(x) T_j(y).
+    std::array<T, 2> _x_range, _y_range;
+
+    static T to_reference(const T x, const std::array<T, 2>& range) noexcept {
+        return (T{2} * x - range[0] - range[1]) / (range[1] - range[0]);
+    }
+
+public:
+    template<uintmax_t Z>
+    using derivative_type = std::conditional_t<X == Z || Y == Z, chebyshev_approximation_2d<T, X, Y>, integral_constant<intmax_t, 0>>;
+
+    explicit chebyshev_approximation_2d(const std::vector<std::vector<T>>& coefficients,
+                                        const std::array<T, 2>& x_range, const std::array<T, 2>& y_range) :
+        _coefficients{coefficients}, _x_range{x_range}, _y_range{y_range} {}
+
+    const std::vector<std::vector<T>>& coefficients() const noexcept { return _coefficients; }
+
+    // Вложенная схема Кленшоу: коэффициенты внешнего ряда по x --- ряды строк по y --- вычисляются по мере надобности,
+    // поэтому вычисление не выделяет память.
+    template<class U>
+    T operator()(const U& x) const {
+        if (_coefficients.empty())
+            return T{0};
+        const T x_reference = to_reference(x[X], _x_range), y_reference = to_reference(x[Y], _y_range);
+        T b1 = T{0}, b2 = T{0};
+        for(size_t i = _coefficients.size(); i-- > 1; ) {
+            const T b = T{2} * x_reference * b1 - b2 + function::chebyshev_series(_coefficients[i], y_reference);
+            b2 = b1;
+            b1 = b;
+        }
+        return function::chebyshev_series(_coefficients[0], y_reference) + x_reference * b1 - b2;
+    }
+
+    // Пакетное вычисление в наборе точек, координаты которых, как и в скалярном варианте, берутся по номерам переменных:
+    // x = points[k][X], y = points[k][Y]. Сначала для всех точек вычисляются ряды по y,
+    // затем по x выполняется схема Кленшоу с коэффициентами, зависящими от точки.
+    template<size_t N>
+    void operator()(const std::vector<std::array<T, N>>& points, T* const out) const {
+        static_assert(X < N && Y < N, "The points dimension is less than the number of the variables.");
+        static constexpr size_t block_size = 256;
+        std::vector<T> x(block_size), y(block_size), b1(block_size), b2(block_size),
+                       row_values(_coefficients.size() * block_size);
+        for(size_t begin = 0; begin < points.size(); begin += block_size) {
+            const size_t size = std::min(block_size, points.size() - begin);
+            for(size_t j = 0; j < size; ++j) {
+                x[j] = to_reference(points[begin + j][X], _x_range);
+                y[j] = to_reference(points[begin + j][Y], _y_range);
+            }
+            for(size_t i = 0; i < _coefficients.size(); ++i)
+                function::chebyshev_series(_coefficients[i], y.data(), size, row_values.data() + i * block_size);
+            std::fill_n(b1.begin(), size, T{0});
+            std::fill_n(b2.begin(), size, T{0});
+            for(size_t i = _coefficients.size(); i-- > 1; )
+                for(size_t j = 0; j < size; ++j) {
+                    const T b = T{2} * x[j] * b1[j] - b2[j] + row_values[i * block_size + j];
+                    b2[j] = b1[j];
+                    b1[j] = b;
+                }
+            for(size_t j = 0; j < size; ++j)
+                out[begin + j] = (_coefficients.empty() ? T{0} : row_values[j]) + x[j] * b1[j] - b2[j];
+        }
+    }
+
+    template<uintmax_t Z>
+    derivative_type<Z> derivative() const {
+        if constexpr (X == Z) {
+            const size_t rows = _coefficients.size(), columns = rows ? _coefficients.front().size() : 0;
+            std::vector<std::vector<T>> coefficients(std::max(rows, size_t{2}) - 1, std::vector<T>(columns));
+            std::vector<T> column(rows);
+            for(size_t j = 0; j < columns; ++j) {
+                for(size_t i = 0; i < rows; ++i)
+                    column[i] = _coefficients[i][j];
+                const std::vector<T> derivative = function::chebyshev_series_derivative(column);
+                for(size_t i = 0; i < derivative.size(); ++i)
+                    coefficients[i][j] = derivative[i] * T{2} / (_x_range[1] - _x_range[0]);
+            }
+            return chebyshev_approximation_2d{coefficients, _x_range, _y_range};
+        } else if constexpr (Y == Z) {
+            std::vector<std::vector<T>> coefficients(_coefficients.size());
+            for(size_t i = 0; i < _coefficients.size(); ++i) {
+                coefficients[i] = function::chebyshev_series_derivative(_coefficients[i]);
+                for(T& coefficient : coefficients[i])
+                    coefficient *= T{2} / (_y_range[1] - _y_range[0]);
+            }
+            return chebyshev_approximation_2d{coefficients, _x_range, _y_range};
+        } else
+            return derivative_type<Z>{};
+    }
+
+    template<uintmax_t... Vars, class Tuple>
+    chebyshev_approximation_2d substitute(const Tuple&) const {
+        static_assert(((Vars != X && Vars != Y) && ...), "The variables of Chebyshev approximation cannot be substituted.");
+        return *this;
+    }
+};
+
+// Построение приближения выражения e по переменной X на отрезке range с погрешностью не более tolerance.
+// Степень полинома подбирается автоматически удвоением числа узлов интерполяции.
+template<uintmax_t X, class E, class T>
+chebyshev_approximation<T, X> approximate(const expression<E>& e, const std::array<T, 2>& range,
+                                          const T tolerance, const size_t max_degree = 4096);
+
+// Приближение выражения двух переменных X и Y на прямоугольнике x_range * y_range.
+template<uintmax_t X, uintmax_t Y, class E, class T>
+chebyshev_approximation_2d<T, X, Y> approximate(const expression<E>& e, const std::array<T, 2>& x_range, const std::array<T, 2>& y_range,
+                                                const T tolerance, const size_t max_degree = 256);
+
+class _chebyshev_approximation final {
+    constexpr explicit _chebyshev_approximation() noexcept = default;
+
+    static constexpr size_t initial_degree = 16;
+
+    template<class T>
+    static T map(const T t, const std::array<T, 2>& range) noexcept {
+        return (range[0] + range[1]) / T{2} + (range[1] - range[0]) / T{2} * t;
+    }
+
+    // Степень, до которой можно отбросить хвост ряда, не превысив половину допустимой погрешности.
+    template<class T>
+    static size_t chop(const std::vector<T>& magnitudes, const T tolerance) {
+        size_t degree = magnitudes.size();
+        for(T tail = 0; degree > 1 && tail + magnitudes[degree - 1] <= tolerance / T{2}; --degree)
+            tail += magnitudes[degree - 1];
+        return degree;
+    }
+
+    template<uintmax_t X, class E, class T>
+    static chebyshev_approximation<T, X> approximate_impl(const E& e, const std::array<T, 2>& range, const T tolerance, const size_t max_degree) {
+        for(size_t n = initial_degree; n <= max_degree; n *= 2) {
+            const std::vector<T> nodes = function::chebyshev_nodes<T>(n);
+            std::vector<T> values(n);
+            std::array<T, X + 1> point = {};
+            for(size_t j = 0; j < n; ++j) {
+                point[X] = map(nodes[j], range);
+                values[j] = e(point);
+            }
+            std::vector<T> coefficients = function::chebyshev_interpolation_coefficients(values), magnitudes(n);
+            for(size_t k = 0; k < n; ++k)
+                magnitudes[k] = std::abs(coefficients[k]);
+            const size_t degree = chop(magnitudes, tolerance);
+            if(degree <= n - n / 4) {
+                coefficients.resize(degree);
+                return chebyshev_approximation<T, X>{coefficients, range};
+            }
+        }
+        throw std::runtime_error{"Chebyshev approximation does not converge to the requested tolerance."};
+    }
+
+    template<uintmax_t X, uintmax_t Y, class E, class T>
+    static chebyshev_approximation_2d<T, X, Y> approximate_impl(const E& e, const std::array<T, 2>& x_range, const std::array<T, 2>& y_range,
+                                                                const T tolerance, const size_t max_degree) {
+        for(size_t n = initial_degree; n <= max_degree; n *= 2) {
+            const std::vector<T> nodes = function::chebyshev_nodes<T>(n);
+            std::vector<std::vector<T>> coefficients(n);
+            std::array<T, std::max(X, Y) + 1> point = {};
+            for(size_t i = 0; i < n; ++i) {
+                std::vector<T> values(n);
+                point[X] = map(nodes[i], x_range);
+                for(size_t j = 0; j < n; ++j) {
+                    point[Y] = map(nodes[j], y_range);
+                    values[j] = e(point);
+                }
+                coefficients[i] = function::chebyshev_interpolation_coefficients(values);
+            }
+            std::vector<T> column(n);
+            for(size_t j = 0; j < n; ++j) {
+                for(size_t i = 0; i < n; ++i)
+                    column[i] = coefficients[i][j];
+                column = function::chebyshev_interpolation_coefficients(column);
+                for(size_t i = 0; i < n; ++i)
+                    coefficients[i][j] = column[i];
+            }
+
+            // Хвосты по каждому направлению оцениваются по максимальным коэффициентам строк и столбцов.
+            std::vector<T> rows_magnitudes(n, T{0}), columns_magnitudes(n, T{0});
+            for(size_t i = 0; i < n; ++i)
+                for(size_t j = 0; j < n; ++j) {
+                    rows_magnitudes[i]    += std::abs(coefficients[i][j]);
+                    columns_magnitudes[j] += std::abs(coefficients[i][j]);
+                }
+            const size_t x_degree = chop(rows_magnitudes, tolerance / T{2}),
+                         y_degree = chop(columns_magnitudes, tolerance / T{2});
+            if(x_degree <= n - n / 4 && y_degree <= n - n / 4) {
+                coefficients.resize(x_degree);
+                for(std::vector<T>& row : coefficients)
+                    row.resize(y_degree);
+                return chebyshev_approximation_2d<T, X, Y>{coefficients, x_range, y_range};
+            }
+        }
+        throw std::runtime_error{"Chebyshev approximation does not converge to the requested tolerance."};
+    }
+
+public:
+    template<uintmax_t X, class E, class T>
+    friend chebyshev_approximation<T, X> approximate(const expression<E>& e, const std::array<T, 2>& range,
+                                                     const T tolerance, const size_t max_degree);
+
+    template<uintmax_t X, uintmax_t Y, class E, class T>
+    friend chebyshev_approximation_2d<T, X, Y> approximate(const expression<E>& e, const std::array<T, 2>& x_range, const std::array<T, 2>& y_range,
+                                                           const T tolerance, const size_t max_degree);
+};
+
+template<uintmax_t X, class E, class T>
+chebyshev_approximation<T, X> approximate(const expression<E>& e, const std::array<T, 2>& range,
+                                          const T tolerance, const size_t max_degree) {
+    return _chebyshev_approximation::approximate_impl<X>(e(), range, tolerance, max_degree);
+}
+
+template<uintmax_t X, uintmax_t Y, class E, class T>
+chebyshev_approximation_2d<T, X, Y> approximate(const expression<E>& e, const std::array<T, 2>& x_range, const std::array<T, 2>& y_range,
+                                                const T tolerance, const size_t max_degree) {
+    return _chebyshev_approximation::approximate_impl<X, Y>(e(), x_range, y_range, tolerance, max_degree);
+}
+
+}
+
+#endif
@@ -0,0 +1,206 @@
+#ifndef SYMDIFF_EVALUATE_HPP
+#define SYMDIFF_EVALUATE_HPP
+
+#include <array>
+#include <tuple>
+#include <vector>
+#include <mutex>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <functional>
+#include <condition_variable>
+#include <algorithm>
+#include <type_traits>
+
+namespace metamath::symdiff {
+
+// Пакетное вычисление кортежа выражений в наборе точек.
+// Результат записывается по столбцам: out[j * points.size() + k] --- значение j-го выражения в k-ой точке.
+// Выражения вычисляются в типе Eval_T, а результат сохраняется в типе T. Это позволяет вычислять выражения
+// в типе меньшей точности (например float, что вдвое увеличивает число значений в векторном регистре),
+// сохраняя накопление результатов в исходной точности.
+// Функция evaluate_parallel распределяет вычисления между потоками, по умолчанию используются все доступные ядра.
+// Потоки создаются при первом вызове и переиспользуются последующими вызовами.
+template<class Eval_T, class... E, class T, size_t N>
+void evaluate_parallel(const std::tuple<E...>& e, const std::vector<std::array<T, N>>& points, T* const out,
+                       const size_t threads_count = std::thread::hardware_concurrency());
+
+class _evaluate final {
+    constexpr explicit _evaluate() noexcept = default;
+
+    static constexpr size_t cache_line_size = 64;
+    static constexpr size_t chunk_size_in_bytes = size_t{1} << 17; // Порция точек и результатов должна помещаться в кэш второго уровня.
+
+    template<class Eval_T, class E, class T, size_t N>
+    static void evaluate_expression(const E& e, const std::array<T, N>* const points, const size_t count, T* const out) {
+        if constexpr (std::is_same_v<Eval_T, T>)
+            for(size_t k = 0; k < count; ++k)
+                out[k] = static_cast<T>(e(points[k]));
+        else
+            for(size_t k = 0; k < count; ++k) {
+                std::array<Eval_T, N> x;
+                for(size_t d = 0; d < N; ++d)
+                    x[d] = static_cast<Eval_T>(points[k][d]);
+                out[k] = static_cast<T>(e(x));
+            }
+    }
+
+    // Вычисление всех выражений в точках с номерами из диапазона [begin, end).
+    template<class Eval_T, class Tuple, class T, size_t N, size_t... I>
+    static void evaluate_range(const Tuple& expressions, const std::vector<std::array<T, N>>& points, T* const out,
+                               const size_t begin, const size_t end, const std::index_sequence<I...>&) {
+        (evaluate_expression<Eval_T>(std::get<I>(expressions), points.data() + begin, end - begin, out + I * points.size() + begin), ...);
+    }
+
+    // Пул потоков, общий для всех вызовов evaluate_parallel. Поток с номером thread при каждом запуске выполняет task(thread),
+    // нулевую часть выполняет вызывающий поток. Запуски выполняются по очереди, поэтому вызывать evaluate_parallel
+    // из вычисляемых выражений нельзя. Недостающие потоки создаются при запуске, требующем их больше, чем уже создано.
+    class thread_pool final {
+        std::mutex _run_mutex, _mutex;
+        std::condition_variable _start, _done;
+        std::vector<std::thread> _workers;
+        const std::function<void(size_t)>* _task = nullptr;
+        std::exception_ptr _exception;
+        size_t _generation = 0, _threads = 0, _pending = 0;
+        bool _stop = false;
+
+        explicit thread_pool() = default;
+
+        // Сохраняется первое исключение, брошенное задачей в любом из потоков, оно пробрасывается из run после завершения всех потоков.
+        void set_exception(std::exception_ptr exception) {
+            const std::lock_guard lock{_mutex};
+            if (!_exception)
+                _exception = std::move(exception);
+        }
+
+        void work(const size_t thread) {
+            for(size_t generation = 0;;) {
+                const std::function<void(size_t)>* task = nullptr;
+                {
+                    std::unique_lock lock{_mutex};
+                    _start.wait(lock, [this, generation] { return _stop || _generation != generation; });
+                    if (_stop)
+                        return;
+                    generation = _generation;
+                    if (thread >= _threads)
+                        continue;
+                    task = _task;
+                }
+                try {
+                    (*task)(thread);
+                } catch(...) {
+                    set_exception(std::current_exception());
+                }
+                const std::lock_guard lock{_mutex};
+                if (--_pending == 0)
+                    _done.notify_one();
+            }
+        }
+
+    public:
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() {
+            {
+                const std::lock_guard lock{_mutex};
+                _stop = true;
+            }
+            _start.notify_all();
+            for(std::thread& worker : _workers)
+                worker.join();
+        }
+
+        static thread_pool& instance() {
+            static thread_pool pool;
+            return pool;
+        }
+
+        void run(const size_t threads, const std::function<void(size_t)>& task) {
+            if (threads <= 1) {
+                task(0);
+                return;
+            }
+            const std::lock_guard run_lock{_run_mutex};
+            {
+                const std::lock_guard lock{_mutex};
+                while (_workers.size() + 1 < threads)
+                    _workers.emplace_back(&thread_pool::work, this, _workers.size() + 1);
+                _task = &task;
+                _threads = threads;
+                _pending = threads - 1;
+                ++_generation;
+            }
+            _start.notify_all();
+            // Даже если задача бросила исключение, run дожидается остальных потоков, которые ещё обращаются к task.
+            try {
+                task(0);
+            } catch(...) {
+                set_exception(std::current_exception());
+            }
+            std::unique_lock lock{_mutex};
+            _done.wait(lock, [this] { return _pending == 0; });
+            _task = nullptr;
+            if (std::exception_ptr exception = std::exchange(_exception, nullptr))
+                std::rethrow_exception(exception);
+        }
+    };
+
+    // Точки разбиваются на порции, размер которых кратен длине кэш-линии результата. Границы порций выровнены относительно начала
+    // каждого столбца, поэтому потоки не делят кэш-линии внутри порций, только если буфер out выровнен по 64 байтам, а число точек
+    // кратно длине кэш-линии; иначе в столбцах j > 0 на каждой границе порций потоки могут делить одну кэш-линию,
+    // что пренебрежимо мало по сравнению с размером порции. Каждый поток пула обрабатывает непрерывный диапазон порций,
+    // поэтому при повторных вызовах с тем же числом точек одни и те же страницы памяти обрабатываются одним и тем же потоком,
+    // что сохраняет локальность данных на NUMA системах при первом касании памяти тем же разбиением.
+    template<class Eval_T, class Tuple, class T, size_t N, size_t... I>
+    static void evaluate_parallel_impl(const Tuple& expressions, const std::vector<std::array<T, N>>& points, T* const out,
+                                       const size_t threads_count, const std::index_sequence<I...>& sequence) {
+        constexpr size_t line = std::max(cache_line_size / sizeof(T), size_t{1});
+        constexpr size_t chunk = std::max(chunk_size_in_bytes / (sizeof(std::array<T, N>) + sizeof...(I) * sizeof(T)) / line, size_t{1}) * line;
+        const size_t chunks_count = (points.size() + chunk - 1) / chunk;
+        const size_t threads = std::max(std::min(threads_count, chunks_count), size_t{1});
+        thread_pool::instance().run(threads, [&](const size_t thread) {
+            const size_t first_chunk = thread * chunks_count / threads, last_chunk = (thread + 1) * chunks_count / threads;
+            for(size_t c = first_chunk; c < last_chunk; ++c)
+                evaluate_range<Eval_T>(expressions, points, out, c * chunk, std::min((c + 1) * chunk, points.size()), sequence);
+        });
+    }
+
+public:
+    template<class Eval_T, class... E, class T, size_t N>
+    friend void evaluate(const std::tuple<E...>& e, const std::vector<std::array<T, N>>& points, T* const out);
+
+    template<class Eval_T, class... E, class T, size_t N>
+    friend void evaluate_parallel(const std::tuple<E...>& e, const std::vector<std::array<T, N>>& points, T* const out, const size_t threads_count);
+};
+
+template<class Eval_T, class... E, class T, size_t N>
+void evaluate(const std::tuple<E...>& e, const std::vector<std::array<T, N>>& points, T* const out) {
+    static_assert(std::is_arithmetic_v<Eval_T>, "The Eval_T must be arithmetic.");
+    _evaluate::evaluate_range<Eval_T>(e, points, out, 0, points.size(), std::make_index_sequence<sizeof...(E)>{});
+}
+
+template<class... E, class T, size_t N>
+void evaluate(const std::tuple<E...>& e, const std::vector<std::array<T, N>>& points, T* const out) {
+    evaluate<T>(e, points, out);
+}
+
+// Параллельный вариант пакетного вычисления. Формат результата совпадает с evaluate.
+// Для полного исключения разделения кэш-линий между потоками буфер out следует выравнивать по 64 байтам,
+// а число точек брать кратным 64 / sizeof(T).
+template<class Eval_T, class... E, class T, size_t N>
+void evaluate_parallel(const std::tuple<E...>& e, const std::vector<std::array<T, N>>& points, T* const out, const size_t threads_count) {
+    static_assert(std::is_arithmetic_v<Eval_T>, "The Eval_T must be arithmetic.");
+    _evaluate::evaluate_parallel_impl<Eval_T>(e, points, out, threads_count, std::make_index_sequence<sizeof...(E)>{});
+}
+
+template<class... E, class T, size_t N>
+void evaluate_parallel(const std::tuple<E...>& e, const std::vector<std::array<T, N>>& points, T* const out,
+                       const size_t threads_count = std::thread::hardware_concurrency()) {
+    evaluate_parallel<T>(e, points, out, threads_count);
+}
+
+}
+
+#endif
@@ -22,14 +22,20 @@ public:
         e{e()} {}
 
     template<class U>
-    constexpr auto operator()(const U& x) const -> decltype(std::abs(e(x))) {
-        return std::abs(e(x));
+    constexpr auto operator()(const U& x) const {
+        using std::abs;
+        return abs(e(x));
     }
 
     template<uintmax_t X>
     constexpr derivative_type<X> derivative() const {
         return e.template derivative<X>() * sign(e);
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return abs(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
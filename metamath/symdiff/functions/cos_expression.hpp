@@ -22,14 +22,20 @@ public:
         e{e()} {}
 
     template<class U>
-    constexpr auto operator()(const U& x) const -> decltype(std::cos(e(x))) {
-        return std::cos(e(x));
+    constexpr auto operator()(const U& x) const {
+        using std::cos;
+        return cos(e(x));
     }
 
     template<uintmax_t X>
     constexpr derivative_type<X> derivative() const {
         return -(sin(e) * e.template derivative<X>());
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return cos(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
@@ -18,14 +18,20 @@ public:
         e{e()} {}
 
     template<class U>
-    constexpr auto operator()(const U& x) const -> decltype(std::exp(e(x))) {
-        return std::exp(e(x));
+    constexpr auto operator()(const U& x) const {
+        using std::exp;
+        return exp(e(x));
     }
 
     template<uintmax_t X>
     constexpr derivative_type<X> derivative() const {
         return exp(e) * e.template derivative<X>();
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return exp(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
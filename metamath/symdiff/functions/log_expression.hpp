@@ -18,14 +18,20 @@ public:
         e{e()} {}
 
     template<class U>
-    constexpr auto operator()(const U& x) const -> decltype(std::log(e(x))) {
-        return std::log(e(x));
+    constexpr auto operator()(const U& x) const {
+        using std::log;
+        return log(e(x));
     }
 
     template<uintmax_t X>
     constexpr derivative_type<X> derivative() const {
         return e.template derivative<X>() / e;
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return log(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
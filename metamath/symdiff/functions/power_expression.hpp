@@ -77,6 +77,11 @@ public:
     constexpr derivative_type<X> derivative() const {
         return integral_constant<intmax_t, N>{} * power<N-1>(e) * e.template derivative<X>();
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return power<N>(e.template substitute<Vars...>(r));
+    }
 };
 
 template<intmax_t N, class E>
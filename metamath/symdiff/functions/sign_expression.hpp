@@ -27,6 +27,11 @@ public:
     constexpr derivative_type<X> derivative() const {
         return derivative_type<X>{};
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return sign(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
@@ -21,14 +21,20 @@ public:
         e{e()} {}
 
     template<class U>
-    constexpr auto operator()(const U& x) const -> decltype(std::sin(e(x))) {
-        return std::sin(e(x));
+    constexpr auto operator()(const U& x) const {
+        using std::sin;
+        return sin(e(x));
     }
 
     template<uintmax_t X>
     constexpr derivative_type<X> derivative() const {
         return cos(e) * e.template derivative<X>();
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return sin(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
@@ -26,14 +26,20 @@ public:
         e{e()} {}
 
     template<class U>
-    constexpr auto operator()(const U& x) const -> decltype(std::sqrt(e(x))) {
-        return std::sqrt(e(x));
+    constexpr auto operator()(const U& x) const {
+        using std::sqrt;
+        return sqrt(e(x));
     }
 
     template<uintmax_t X>
     constexpr derivative_type<X> derivative() const {
         return e.template derivative<X>() / (integral_constant<int, 2>{} * sqrt(e));
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return sqrt(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
@@ -23,14 +23,20 @@ public:
         e{e()} {}
 
     template<class U>
-    constexpr auto operator()(const U& x) const -> decltype(std::tan(e(x))) {
-        return std::tan(e(x));
+    constexpr auto operator()(const U& x) const {
+        using std::tan;
+        return tan(e(x));
     }
 
     template<uintmax_t X>
     constexpr derivative_type<X> derivative() const {
         return e.template derivative<X>() / power<2>(cos(e));
     }
+
+    template<uintmax_t... Vars, class Tuple>
+    constexpr auto substitute(const Tuple& r) const {
+        return tan(e.template substitute<Vars...>(r));
+    }
 };
 
 template<class E>
@@ -0,0 +1,57 @@
+#ifndef SYMDIFF_SUBSTITUTE_HPP
+#define SYMDIFF_SUBSTITUTE_HPP
+
+#include <tuple>
+#include <utility>
+#include "constant.hpp"
+
+namespace metamath::symdiff {
+
+// Подстановка выражений вместо переменных. Подстановка выполняется одновременно для всех перечисленных переменных,
+// поэтому выражения вида substitute<x, y>(f, y, x) корректно меняют переменные местами.
+// Результатом является новое выражение, поэтому его производные автоматически вычисляются по правилу дифференцирования сложной функции.
+class _substitute final {
+    constexpr explicit _substitute() noexcept = default;
+
+    template<class R>
+    static constexpr const R& to_expression(const expression<R>& r) {
+        return r();
+    }
+
+    template<class T>
+    static constexpr std::enable_if_t<std::is_arithmetic_v<T>, constant<T>> to_expression(const T& r) {
+        return constant<T>{r};
+    }
+
+    template<uintmax_t... Vars, class E, class... R>
+    static constexpr auto substitute_impl(const E& e, const R&... r) {
+        static_assert(sizeof...(Vars) == sizeof...(R), "The number of variables and substituted expressions does not match.");
+        return e.template substitute<Vars...>(std::make_tuple(to_expression(r)...));
+    }
+
+    template<uintmax_t... Vars, class Tuple, size_t... I, class... R>
+    static constexpr auto substitute_tuple_impl(const Tuple& expressions, const std::index_sequence<I...>&, const R&... r) {
+        return std::make_tuple(substitute_impl<Vars...>(std::get<I>(expressions), r...)...);
+    }
+
+public:
+    template<uintmax_t X, uintmax_t... Vars, class E, class... R>
+    friend constexpr auto substitute(const expression<E>& e, const R&... r);
+
+    template<uintmax_t X, uintmax_t... Vars, class... E, class... R>
+    friend constexpr auto substitute(const std::tuple<E...>& e, const R&... r);
+};
+
+template<uintmax_t X, uintmax_t... Vars, class E, class... R>
+constexpr auto substitute(const expression<E>& e, const R&... r) {
+    return _substitute::substitute_impl<X, Vars...>(e(), r...);
+}
+
+template<uintmax_t X, uintmax_t... Vars, class... E, class... R>
+constexpr auto substitute(const std::tuple<E...>& e, const R&... r) {
+    return _substitute::substitute_tuple_impl<X, Vars...>(e, std::make_index_sequence<sizeof...(E)>{}, r...);
+}
+
+}
+
+#endif
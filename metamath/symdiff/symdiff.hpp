@@ -4,7 +4,11 @@
 #include "base/symdiff_base.hpp"
 #include "functions/symdiff_functions.hpp"
 #include "derivative.hpp"
+#include "substitute.hpp"
 #include "to_function.hpp"
+#include "evaluate.hpp"
+#include "taylor.hpp"
+#include "chebyshev_approximation.hpp"
 #include "make_variables.hpp"
 
 #endif
\ No newline at end of file
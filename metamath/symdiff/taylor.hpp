@@ -0,0 +1,275 @@
+#ifndef SYMDIFF_TAYLOR_HPP
+#define SYMDIFF_TAYLOR_HPP
+
+#include <cmath>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace metamath::symdiff {
+
+// Усечённый ряд Тейлора (струя) порядка K: a(t) = a_0 + a_1 t + ... + a_K t^K.
+// Вычисление выражения от струй за один проход даёт все производные до порядка K включительно.
+// Каждая операция над струями требует O(K^2) действий, поэтому, в отличие от многократного символьного
+// дифференцирования, размер которого растёт экспоненциально, стоимость растёт полиномиально с ростом порядка.
+template<class T, size_t K>
+class jet {
+    static_assert(std::is_floating_point_v<T>, "The T must be floating point.");
+
+    std::array<T, K + 1> _coefficients = {};
+
+public:
+    constexpr jet() noexcept = default;
+
+    template<class U, class = std::enable_if_t<std::is_arithmetic_v<U>>>
+    constexpr jet(const U value) noexcept {
+        _coefficients[0] = static_cast<T>(value);
+    }
+
+    static constexpr size_t order() noexcept { return K; }
+
+    constexpr T& operator[](const size_t k) noexcept { return _coefficients[k]; }
+    constexpr const T& operator[](const size_t k) const noexcept { return _coefficients[k]; }
+
+    constexpr T value() const noexcept { return _coefficients[0]; }
+
+    // Производная порядка k равна k! a_k.
+    constexpr T derivative(const size_t k) const noexcept {
+        T factorial = T{1};
+        for(size_t i = 2; i <= k; ++i)
+            factorial *= T(i);
+        return factorial * _coefficients[k];
+    }
+};
+
+template<class T, size_t K>
+constexpr jet<T, K> operator-(const jet<T, K>& a) {
+    jet<T, K> result;
+    for(size_t k = 0; k <= K; ++k)
+        result[k] = -a[k];
+    return result;
+}
+
+template<class T, size_t K>
+constexpr jet<T, K> operator+(const jet<T, K>& a, const jet<T, K>& b) {
+    jet<T, K> result;
+    for(size_t k = 0; k <= K; ++k)
+        result[k] = a[k] + b[k];
+    return result;
+}
+
+template<class T, size_t K>
+constexpr jet<T, K> operator-(const jet<T, K>& a, const jet<T, K>& b) {
+    jet<T, K> result;
+    for(size_t k = 0; k <= K; ++k)
+        result[k] = a[k] - b[k];
+    return result;
+}
+
+template<class T, size_t K>
+constexpr jet<T, K> operator*(const jet<T, K>& a, const jet<T, K>& b) {
+    jet<T, K> result;
+    for(size_t k = 0; k <= K; ++k)
+        for(size_t i = 0; i <= k; ++i)
+            result[k] += a[i] * b[k-i];
+    return result;
+}
+
+template<class T, size_t K>
+constexpr jet<T, K> operator/(const jet<T, K>& a, const jet<T, K>& b) {
+    jet<T, K> result;
+    for(size_t k = 0; k <= K; ++k) {
+        result[k] = a[k];
+        for(size_t i = 1; i <= k; ++i)
+            result[k] -= b[i] * result[k-i];
+        result[k] /= b[0];
+    }
+    return result;
+}
+
+template<class T, size_t K, class U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator+(const jet<T, K>& a, const U b) {
+    jet<T, K> result = a;
+    result[0] += static_cast<T>(b);
+    return result;
+}
+
+template<class U, class T, size_t K>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator+(const U a, const jet<T, K>& b) {
+    return b + a;
+}
+
+template<class T, size_t K, class U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator-(const jet<T, K>& a, const U b) {
+    jet<T, K> result = a;
+    result[0] -= static_cast<T>(b);
+    return result;
+}
+
+template<class U, class T, size_t K>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator-(const U a, const jet<T, K>& b) {
+    return -b + a;
+}
+
+template<class T, size_t K, class U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator*(const jet<T, K>& a, const U b) {
+    jet<T, K> result;
+    for(size_t k = 0; k <= K; ++k)
+        result[k] = a[k] * static_cast<T>(b);
+    return result;
+}
+
+template<class U, class T, size_t K>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator*(const U a, const jet<T, K>& b) {
+    return b * a;
+}
+
+template<class T, size_t K, class U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator/(const jet<T, K>& a, const U b) {
+    return a * (T{1} / static_cast<T>(b));
+}
+
+template<class U, class T, size_t K>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, jet<T, K>> operator/(const U a, const jet<T, K>& b) {
+    return jet<T, K>{a} / b;
+}
+
+// Сравнения с числами используют значение в точке разложения, этого достаточно для вычисления функции sign.
+template<class T, size_t K, class U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, bool> operator<(const jet<T, K>& a, const U b) {
+    return a[0] < b;
+}
+
+template<class T, size_t K, class U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, bool> operator>(const jet<T, K>& a, const U b) {
+    return a[0] > b;
+}
+
+template<class T, size_t K>
+jet<T, K> exp(const jet<T, K>& a) {
+    jet<T, K> result;
+    result[0] = std::exp(a[0]);
+    for(size_t k = 1; k <= K; ++k) {
+        for(size_t i = 1; i <= k; ++i)
+            result[k] += T(i) * a[i] * result[k-i];
+        result[k] /= T(k);
+    }
+    return result;
+}
+
+template<class T, size_t K>
+jet<T, K> log(const jet<T, K>& a) {
+    jet<T, K> result;
+    result[0] = std::log(a[0]);
+    for(size_t k = 1; k <= K; ++k) {
+        T sum = T{0};
+        for(size_t i = 1; i < k; ++i)
+            sum += T(i) * result[i] * a[k-i];
+        result[k] = (a[k] - sum / T(k)) / a[0];
+    }
+    return result;
+}
+
+template<class T, size_t K>
+jet<T, K> sqrt(const jet<T, K>& a) {
+    jet<T, K> result;
+    result[0] = std::sqrt(a[0]);
+    for(size_t k = 1; k <= K; ++k) {
+        T sum = T{0};
+        for(size_t i = 1; i < k; ++i)
+            sum += result[i] * result[k-i];
+        result[k] = (a[k] - sum) / (T{2} * result[0]);
+    }
+    return result;
+}
+
+// Синус и косинус вычисляются совместно, так как рекуррентные соотношения для их коэффициентов связаны.
+template<class T, size_t K>
+std::array<jet<T, K>, 2> sin_cos(const jet<T, K>& a) {
+    jet<T, K> s, c;
+    s[0] = std::sin(a[0]);
+    c[0] = std::cos(a[0]);
+    for(size_t k = 1; k <= K; ++k) {
+        for(size_t i = 1; i <= k; ++i) {
+            s[k] += T(i) * a[i] * c[k-i];
+            c[k] -= T(i) * a[i] * s[k-i];
+        }
+        s[k] /= T(k);
+        c[k] /= T(k);
+    }
+    return {s, c};
+}
+
+template<class T, size_t K>
+jet<T, K> sin(const jet<T, K>& a) {
+    return sin_cos(a)[0];
+}
+
+template<class T, size_t K>
+jet<T, K> cos(const jet<T, K>& a) {
+    return sin_cos(a)[1];
+}
+
+template<class T, size_t K>
+jet<T, K> tan(const jet<T, K>& a) {
+    const auto [s, c] = sin_cos(a);
+    return s / c;
+}
+
+template<class T, size_t K>
+jet<T, K> abs(const jet<T, K>& a) {
+    return a[0] < 0 ? -a : a;
+}
+
+class _taylor final {
+    constexpr explicit _taylor() noexcept = default;
+
+    template<uintmax_t X, size_t K, class T, class Container>
+    static Container& seed(Container& jets, const size_t size, const T* const point) {
+        for(size_t d = 0; d < size; ++d)
+            jets[d] = jet<T, K>{point[d]};
+        if constexpr (K > 0) // При K == 0 ряд содержит только значение.
+            jets[X][1] = T{1};
+        return jets;
+    }
+
+public:
+    template<uintmax_t X, size_t K, class E, class T, size_t N>
+    friend auto taylor(const E& e, const std::array<T, N>& point);
+
+    template<uintmax_t X, size_t K, class E, class T>
+    friend auto taylor(const E& e, const std::vector<T>& point);
+};
+
+// Разложение выражения в ряд Тейлора по переменной X в точке point. Производные по X до порядка K включительно
+// получаются за один проход по дереву выражения: taylor<x, K>(e, point).derivative(k).
+template<uintmax_t X, size_t K, class E, class T, size_t N>
+auto taylor(const E& e, const std::array<T, N>& point) {
+    static_assert(X < N, "The variable is out of the point range.");
+    std::array<jet<T, K>, N> jets;
+    return jet<T, K>{e(_taylor::seed<X, K>(jets, N, point.data()))};
+}
+
+template<uintmax_t X, size_t K, class E, class T>
+auto taylor(const E& e, const std::vector<T>& point) {
+    if (X >= point.size())
+        throw std::out_of_range{"The variable is out of the point range."};
+    std::vector<jet<T, K>> jets(point.size());
+    return jet<T, K>{e(_taylor::seed<X, K>(jets, point.size(), point.data()))};
+}
+
+// Все производные выражения по переменной X до порядка K включительно.
+template<uintmax_t X, size_t K, class E, class Container>
+auto taylor_derivatives(const E& e, const Container& point) {
+    const auto series = taylor<X, K>(e, point);
+    std::array<std::decay_t<decltype(series.value())>, K + 1> derivatives;
+    for(size_t k = 0; k <= K; ++k)
+        derivatives[k] = series.derivative(k);
+    return derivatives;
+}
+
+}
+
+#endif